@@ -3,6 +3,10 @@
 *  Licensed under the MIT License.  See license.txt in the project root.
 */
 
+#if defined ( __linux__ ) && !defined ( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
 #include <limits.h>
 #include <ctype.h>
 #include <string.h>
@@ -13,6 +17,59 @@
 
 
 
+/*
+** MAIN_SEEKDATA macro
+*
+*  This macro is present where the "lseek" function can find the data that
+*  follows a hole of a sparse file ("SEEK_DATA"), which the "-h" option uses to
+*  skip holes without reading them.
+*
+*  Remarks
+*
+*  Linux, the BSDs, macOS and Solaris have "SEEK_DATA" as an extension of POSIX,
+*  which the GNU C library only declares when the "_GNU_SOURCE" macro precedes
+*  the first "#include" directive.  Elsewhere, holes simply read as zero bytes.
+*/
+
+#if defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )
+
+#include <sys/types.h>
+#include <unistd.h>
+#include <errno.h>
+
+#if defined ( SEEK_DATA ) && defined ( ENXIO )
+#define MAIN_SEEKDATA
+#endif
+
+#endif
+
+
+
+/*
+** MAIN_CRC32C macro
+*
+*  This macro is present where the compiler targets a processor with CRC32C
+*  instructions (i.e.: SSE 4.2's "crc32" instruction or ARMv8's "crc32cw"
+*  instruction), which the "-k" option's checksums then use four bytes at a
+*  time, instead of a table.  It updates a CRC32C register with a word.
+*/
+
+#if defined ( __SSE4_2__ ) || defined ( __AVX__ )
+
+#include <nmmintrin.h>
+
+#define MAIN_CRC32C( crc, word )  _mm_crc32_u32 ( ( crc ), ( word ) )
+
+#elif defined ( __ARM_FEATURE_CRC32 )
+
+#include <arm_acle.h>
+
+#define MAIN_CRC32C( crc, word )  __crc32cw ( ( crc ), ( word ) )
+
+#endif
+
+
+
 /*
 ** restrict keyword-like macro
 *
@@ -166,6 +223,655 @@ typedef enum
 
 
 
+/*
+** MAIN_ENCODEDSIZE macro
+*
+*  This macro is the maximum number of characters that the encoder, the
+*  "main_runbin2c_encode" function, outputs per byte of the input binary file.
+*
+*  Remarks
+*
+*  The worst case is one byte per line with an offset comment before every line,
+*  which means a line break (",\n"), the offset comment (its indentation, its
+*  delimiters and "0x" take 13 characters, in addition to the digits of an
+*  "unsigned long"), the indentation ("    ") and the value itself ("0xFFu").
+*/
+
+#define MAIN_ENCODEDSIZE  ( 2u + ( 9u + ( sizeof ( unsigned long ) * 2u ) + 4u ) + 4u + 5u )
+
+
+
+/*
+** MAIN_TYPEDSIZE macro
+*
+*  This macro is the number of characters, including the null-terminating
+*  character, that "main_runtyped_format" outputs at most per element of a
+*  typed array, with the "-t" option.
+*
+*  Remarks
+*
+*  The worst case is the minimum of "int64_t", which is a subtraction (i.e.:
+*  "( -INT64_C ( 0x7FFFFFFFFFFFFFFF ) - 1 )") that takes 39 characters.
+*/
+
+#define MAIN_TYPEDSIZE  48u
+
+
+
+/*
+** MAIN_TEXTSIZE macro
+*
+*  This macro is the number of characters, including the null-terminating
+*  character, that "main_runtext_escape" outputs at most per byte of an input
+*  text file (i.e.: an octal escape sequence, such as "\377").
+*/
+
+#define MAIN_TEXTSIZE  5u
+
+
+
+/*
+** MAIN_SHARDALIGNMENT macro
+*
+*  This macro is the alignment of each shard of the array, with the "-j" option,
+*  and the granularity of the shards' sizes.
+*
+*  Remarks
+*
+*  Compilers typically align large arrays to a cache line (or less) on their
+*  own.  Explicitly aligning each shard to a full cache line, and sizing every
+*  shard but the last as a multiple of it, means there is neither a gap nor
+*  overlap between consecutive shards in their shared section.
+*/
+
+#define MAIN_SHARDALIGNMENT  64u
+
+
+
+/*
+** MAIN_MSVCALIGNMENT macro
+*
+*  This macro is the greatest alignment that Microsoft's compilers accept, in
+*  bytes, with the "-a" option.
+*/
+
+#define MAIN_MSVCALIGNMENT  8192u
+
+
+
+/*
+** MAIN_LZWINDOW, MAIN_LZHASHBITS and MAIN_LZDEPTH macros
+*
+*  These macros tune the LZ compressor of the "-c" option: the default window
+*  (i.e.: one more than the maximum distance of a match), the number of bits of
+*  the hash of the next four bytes that heads the chains of earlier positions,
+*  and the maximum number of earlier positions the compressor tries per match.
+*
+*  Remarks
+*
+*  The window matches the 16-bit offsets of the LZ4 block format that the
+*  compressor outputs.  Since the compressor runs at build time, it searches a
+*  chain of candidates for the longest match instead of taking the first one,
+*  which trades compression speed for a smaller array at no cost to decoding.
+*  Runs of a constant byte of at least "MAIN_LZRUN" bytes skip that search and
+*  become a match at a distance of one (i.e.: a run-length record).
+*/
+
+#define MAIN_LZWINDOW    65536ul
+#define MAIN_LZHASHBITS  12u
+#define MAIN_LZDEPTH     32u
+#define MAIN_LZRUN       64u
+
+
+
+/*
+** MAIN_LZDICTIONARY, MAIN_LZSEGMENT, MAIN_LZSAMPLE and MAIN_LZTRAINBITS macros
+*
+*  These macros tune the training of the shared dictionary of the "-d" option:
+*  the maximum size of the dictionary, the size of the segments it consists of,
+*  the maximum number of bytes of each input binary file to train on, and the
+*  number of bits of the hash of eight bytes that counts the input binary files
+*  that have them.
+*
+*  Remarks
+*
+*  The dictionary is also limited to half the window, so that the data's
+*  matches can still reach the whole dictionary from the data's first half.
+*/
+
+#define MAIN_LZDICTIONARY  32768ul
+#define MAIN_LZSEGMENT     64u
+#define MAIN_LZSAMPLE      ( 1024ul * 1024ul )
+#define MAIN_LZTRAINBITS   18u
+
+
+
+/*
+** MAIN_AUTOMINIMUM and MAIN_AUTOENTROPY macros
+*
+*  These macros tune the policy of the "-c auto" option: the size below which an
+*  input binary file is too small to compress (without a shared dictionary) and
+*  the entropy, in hundredths of a bit per byte, from which its data counts as
+*  incompressible.
+*
+*  Remarks
+*
+*  Uniformly random data has eight bits of entropy per byte.  An order-0
+*  estimate above seven and a half bits leaves too little for an LZ codec to
+*  gain, which is typical of data that is already compressed or encrypted.
+*/
+
+#define MAIN_AUTOMINIMUM  64u
+#define MAIN_AUTOENTROPY  750u
+
+
+
+/*
+** MAIN_DEDUPMINIMUM, MAIN_DEDUPMAXIMUM and MAIN_DEDUPBITS macros
+*
+*  These macros tune the content-defined chunking of the "-y" option: the
+*  minimum and maximum size of a chunk and the number of bits of the gear hash
+*  that must be zero to end a chunk (i.e.: chunks average about
+*  "1 << MAIN_DEDUPBITS" bytes beyond the minimum size).
+*
+*  Remarks
+*
+*  Smaller chunks find more of what the input binary files have in common, but
+*  every chunk costs two elements of a chunk table.
+*/
+
+#define MAIN_DEDUPMINIMUM  1024u
+#define MAIN_DEDUPMAXIMUM  16384u
+#define MAIN_DEDUPBITS     12u
+
+
+
+/*
+** MAIN_DELTAHASHBITS and MAIN_DELTAMINIMUM macros
+*
+*  These macros tune the delta encoder of the "-v" option: the number of bits
+*  of the hash that indexes positions of the base and the number of bytes that
+*  the hash covers, which is also the minimum length of a copy from the base.
+*/
+
+#define MAIN_DELTAHASHBITS  18u
+#define MAIN_DELTAMINIMUM   8u
+
+
+
+/*
+** MAIN_PACKALIGNMENT, MAIN_PACKLOAD and MAIN_PACKSEEDS macros
+*
+*  These macros tune the pack of the "-u" option: the alignment of every input
+*  binary file's data in it (and the pack's own minimum alignment), so that the
+*  data is as aligned as a vector register needs, and, for the perfect hash of
+*  the "-i" option, the average number of names per bucket and the number of
+*  seeds to try per bucket before giving up.
+*
+*  Remarks
+*
+*  Fewer names per bucket make the seeds easier to find, but every bucket costs
+*  an element of the "_seeds" array.
+*/
+
+#define MAIN_PACKALIGNMENT  16u
+#define MAIN_PACKLOAD       4u
+#define MAIN_PACKSEEDS      16777216ul
+
+
+
+/*
+** MAIN_MMAPALIGNMENT macro
+*
+*  This macro is the alignment of every input binary file's data in the pack
+*  file of the "-f" option, and the size of the stamp that precedes it, which
+*  is the page size of most systems.  Input binary files that start on pages of
+*  their own are paged in on their own.
+*/
+
+#define MAIN_MMAPALIGNMENT  4096u
+
+
+
+/*
+** MAIN_CACHEBUDGET macro
+*
+*  This macro is the default budget of the decompression cache of the "-q"
+*  option, in bytes of decoded data, which is what the cache's source file
+*  defines unless the program's build overrides it.
+*/
+
+#define MAIN_CACHEBUDGET  16777216ul
+
+
+
+/*
+** main_form enumeration
+*
+*  This enumeration lists the forms the output C file(s) can take, as selected
+*  by the "<mode>" parameter of the "-m" option.
+*
+*  Value(s)
+*
+*  MAIN_FORM_DEFAULT:  the array has either static scope in a header file or,
+*                      when the "-g" or "-l" option is present, global scope
+*  MAIN_FORM_INLINE:   the array has global scope, but its definition resides in
+*                      a header file in a form that the linker folds into a
+*                      single definition ("inline constexpr" in C++17 and weak
+*                      or "selectany" symbols in C)
+*  MAIN_FORM_CONSTEXPR:  the array is a C++17 "inline constexpr" "std::array" of
+*                        64-bit words in a header file, with "constexpr"
+*                        accessors, for use in constant evaluation
+*  MAIN_FORM_MODULE:     the array and its size are exported from a C++20 module
+*                        interface unit instead of a header file, so importers
+*                        reuse the compiled interface instead of parsing the
+*                        initializer
+*  MAIN_FORM_COLUMNS:    the records of the "-t" option's layout are transposed
+*                        into an array per field (i.e.: a structure of arrays)
+*                        instead of an array of structures
+*  MAIN_FORM_TEXT:       the array is a null-terminated string literal in a
+*                        header file, with its length and, in C++17, a
+*                        "std::string_view" of it
+*  MAIN_FORM_LINES:      like "MAIN_FORM_TEXT", with an array of the offsets at
+*                        which the lines start
+*/
+
+typedef enum
+{
+    MAIN_FORM_DEFAULT = 0,
+    MAIN_FORM_INLINE,
+    MAIN_FORM_CONSTEXPR,
+    MAIN_FORM_MODULE,
+    MAIN_FORM_COLUMNS,
+    MAIN_FORM_TEXT,
+    MAIN_FORM_LINES
+} main_form;
+
+
+
+/*
+** main_codec enumeration
+*
+*  This enumeration lists the codecs that can compress the data of the array,
+*  as selected by the "<codec>" parameter of the "-c" option.
+*
+*  Value(s)
+*
+*  MAIN_CODEC_NONE:  the array holds the input binary file's data unaltered
+*  MAIN_CODEC_LZ:    the array holds the data compressed in the LZ4 block format,
+*                    which the functions of the "bin2c_lz.h" header file decode
+*  MAIN_CODEC_AUTO:  the array holds either of the above, as "main_runbin2c"
+*                    decides for each input binary file from its content
+*  MAIN_CODEC_DELTA: the array holds the data as a delta against the base of the
+*                    "-v" option, which the functions of the "bin2c_delta.h"
+*                    header file apply
+*/
+
+typedef enum
+{
+    MAIN_CODEC_NONE = 0,
+    MAIN_CODEC_LZ,
+    MAIN_CODEC_AUTO,
+    MAIN_CODEC_DELTA
+} main_codec;
+
+
+
+/*
+** main_kind enumeration
+*
+*  This enumeration lists the kinds of values that the elements of a typed
+*  array hold, as the "<type>" parameter of the "-t" option selects them.
+*
+*  Value(s)
+*
+*  MAIN_KIND_UNSIGNED:  the elements are unsigned integers
+*  MAIN_KIND_SIGNED:    the elements are two's complement signed integers
+*  MAIN_KIND_FLOAT:     the elements are IEEE 754 binary floating-point numbers
+*/
+
+typedef enum
+{
+    MAIN_KIND_UNSIGNED = 0,
+    MAIN_KIND_SIGNED,
+    MAIN_KIND_FLOAT
+} main_kind;
+
+
+
+/*
+** main_type type
+*
+*  This type describes an element type of the "-t" option, which
+*  "main_parsetype" looks up by its keyword.
+*
+*  Member(s)
+*
+*  name:      pointer to the keyword that selects the type
+*  declared:  pointer to the name of the type in the output header file
+*  suffix:    pointer to the suffix of the type's integer literals (unused for
+*             64-bit integers, whose literals are "INT64_C" and "UINT64_C"
+*             macros, and for floating-point numbers)
+*  size:      the number of bytes of an element
+*  kind:      the kind of values that the elements hold
+*/
+
+typedef struct
+{
+    char const * name;
+    char const * declared;
+    char const * suffix;
+    unsigned int size;
+    main_kind    kind;
+} main_type;
+
+
+
+/*
+** main_field type
+*
+*  This type describes a field of the records of the "-t" option's layout,
+*  which "main_readlayout" reads.
+*
+*  Member(s)
+*
+*  name:       pointer to the name of the field, which is a C identifier
+*  element:    pointer to the type of the field
+*  bigendian:  whether the field is big-endian (as opposed to little-endian)
+*  offset:     the offset of the field in a record, in bytes
+*/
+
+typedef struct
+{
+    char const *      name;
+    main_type const * element;
+    bool              bigendian;
+    unsigned long     offset;
+} main_field;
+
+
+
+/*
+** main_arguments type
+*
+*  This type gathers the parameters of the command-line options so that the
+*  parser, "main_parseargs", and the core function, "main_runbin2c", can share
+*  them without an ever-growing list of function parameters.  Every pointer
+*  member is "NULL" when the corresponding option is not present.
+*
+*  Member(s)
+*
+*  prefix:     pointer to the "<array_prefix>" parameter of the "-p" option
+*  suffix:     pointer to the "<array_suffix>" parameter of the "-s" option
+*  global:     pointer to the "<length_suffix>" parameter of the "-g" option
+*  extent:     pointer to the "<length_suffix>" parameter of the "-l" option
+*  end:        pointer to the "<end_suffix>" parameter of the "-e" option
+*  mode:       pointer to the "<mode>" parameter of the "-m" option
+*  form:       the form of the output C file(s), which "main" derives from
+*              "mode"
+*  shards:     pointer to the "<shard_size>" parameter of the "-j" option
+*  shardsize:  the number of elements in each shard but the last, which "main"
+*              derives from "shards"
+*  lines:      pointer to the "<bytes_per_line>" parameter of the "-b" option
+*  linesize:   the number of elements per line, which "main" derives from
+*              "lines"
+*  marks:      pointer to the "<offset_lines>" parameter of the "-n" option
+*  marksize:   the number of lines between offset comments, which "main"
+*              derives from "marks"
+*  alignment:  pointer to the "<alignment>" parameter of the "-a" option
+*  alignsize:  the alignment of the array in bytes, which "main" derives from
+*              "alignment"
+*  section:    pointer to the "<section>" parameter of the "-x" option
+*  padding:    pointer to the "<padding>" parameter of the "-z" option
+*  padsize:    the number of zero bytes after the array's data, which "main"
+*              derives from "padding"
+*  codec:      pointer to the "<codec>" parameter of the "-c" option
+*  coding:     the codec that compresses the array's data, which "main" derives
+*              from "codec"
+*  automatic:  whether "coding" is the choice of the "-c auto" option for the
+*              input binary file, which "main_runbin2c" makes
+*  window:     pointer to the "<window>" parameter of the "-w" option
+*  windowsize: the window of the codec in bytes, which "main" derives from
+*              "window"
+*  blocks:     pointer to the "<block_size>" parameter of the "-k" option
+*  blocksize:  the number of bytes each independently compressed block decodes
+*              to, which "main" derives from "blocks"; zero without a plain
+*              size in "blocks"
+*  hashsize:   the number of bytes of each block with a CRC32C checksum, which
+*              "main" derives from the "crc32c:" item of "blocks"; zero without
+*              one
+*  dictionary: pointer to the "<dictionary>" parameter of the "-d" option
+*  trained:    pointer to the shared dictionary, which "main" trains on the input
+*              binary files
+*  dictsize:   the number of bytes of the shared dictionary
+*  holes:      pointer to the "<hole_size>" parameter of the "-h" option
+*  holesize:   the minimum number of zero bytes that form a hole, which "main"
+*              derives from "holes"
+*  pool:       pointer to the "<pool>" parameter of the "-y" option
+*  base:       pointer to the "<base_file>" parameter of the "-v" option
+*  basename:   pointer to the name of the base's array, which "main" derives
+*              from "base"
+*  baseline:   pointer to the base's data, which "main" reads
+*  basesize:   the number of bytes of the base's data
+*  pack:       pointer to the "<pack>" parameter of the "-u" option
+*  lookup:     pointer to the "<lookup>" parameter of the "-i" option
+*  sidecar:    pointer to the "<mapped_pack>" parameter of the "-f" option
+*  reload:     pointer to the "<reload_macro>" parameter of the "-r" option
+*  origin:     pointer to the full pathname of the input binary file, with the
+*              "-r" option, which "main" resolves for every input binary file
+*  trace:      pointer to the "<trace_file>" parameter of the "-o" option
+*  order:      pointer to the indices of the input binary files in the order of
+*              the access trace, which "main" derives from "trace"
+*  hotcount:   the number of input binary files that the access trace names
+*  cache:      pointer to the "<cache>" parameter of the "-q" option
+*  type:       pointer to the "<type>" parameter of the "-t" option
+*  element:    pointer to the element type of the array, which "main" derives
+*              from "type"
+*  bigendian:  whether the input binary file's elements are big-endian (as
+*              opposed to little-endian), which "main" derives from "type"
+*  layout:     pointer to the text of the records' layout, when "type" names no
+*              element type, which "main" copies or reads from the schema file
+*  fields:     pointer to the fields of the records, which "main" derives from
+*              "layout"; "NULL" when "type" names an element type
+*  fieldcount: the number of fields of a record
+*  recordsize: the number of bytes of a record
+*
+*  Remarks
+*
+*  The "-g" and "-l" options both give the name global scope.  They differ in
+*  how the header file expresses the number of elements: "-g" uses a macro,
+*  which changes whenever the size of the input binary file changes, whereas
+*  "-l" uses an "extern" constant that the source file defines, so that the
+*  header file only changes when the names change.
+*/
+
+typedef struct
+{
+    char const * restrict prefix;
+    char const * restrict suffix;
+    char const * restrict global;
+    char const * restrict extent;
+    char const * restrict end;
+    char const * restrict mode;
+    main_form             form;
+    char const * restrict shards;
+    unsigned long         shardsize;
+    char const * restrict lines;
+    unsigned long         linesize;
+    char const * restrict marks;
+    unsigned long         marksize;
+    char const * restrict alignment;
+    unsigned long         alignsize;
+    char const * restrict section;
+    char const * restrict padding;
+    unsigned long         padsize;
+    char const * restrict codec;
+    main_codec            coding;
+    bool                  automatic;
+    char const * restrict window;
+    unsigned long         windowsize;
+    char const * restrict blocks;
+    unsigned long         blocksize;
+    unsigned long         hashsize;
+    char const * restrict dictionary;
+    unsigned char *       trained;
+    unsigned long         dictsize;
+    char const * restrict holes;
+    unsigned long         holesize;
+    char const * restrict pool;
+    char const * restrict base;
+    char const * restrict basename;
+    unsigned char *       baseline;
+    unsigned long         basesize;
+    char const * restrict pack;
+    char const * restrict lookup;
+    char const * restrict sidecar;
+    char const * restrict reload;
+    char const * restrict origin;
+    char const * restrict trace;
+    int *                 order;
+    int                   hotcount;
+    char const * restrict cache;
+    char const * restrict type;
+    main_type const *     element;
+    bool                  bigendian;
+    char *                layout;
+    main_field *          fields;
+    unsigned long         fieldcount;
+    unsigned long         recordsize;
+} main_arguments;
+
+
+
+/*
+** main_compression type
+*
+*  This type describes the compressed data of the array, with the "-c" option,
+*  which "main_runbin2c_compress" produces for the functions that output the
+*  array's declarations and definitions, and the checksums of the input binary
+*  file's data, with the "-k" option's "crc32c:" item, which
+*  "main_runbin2c_digest" produces.
+*
+*  Member(s)
+*
+*  decoded:  the number of bytes the array decodes to (i.e.: the size of the
+*            input binary file)
+*  encoded:  the number of bytes of the compressed data
+*  blocks:   pointer to the block index, with the "-k" option's block size,
+*            which holds the offset of each block in the array and, last, the
+*            array's length; "NULL" without it
+*  count:    the number of blocks
+*  checksum: the CRC32C checksum of the input binary file's data
+*  hashes:   pointer to the CRC32C checksum of each block of the input binary
+*            file's data, with the "-k" option's "crc32c:" item; "NULL" without
+*            it
+*  hashed:   the number of checksums of blocks
+*/
+
+typedef struct
+{
+    unsigned long            decoded;
+    unsigned long            encoded;
+    unsigned long * restrict blocks;
+    unsigned long            count;
+    unsigned long            checksum;
+    unsigned long * restrict hashes;
+    unsigned long            hashed;
+} main_compression;
+
+
+
+/*
+** main_dedup type
+*
+*  This type describes how the "-y" option deduplicates the input binary files,
+*  which "main_dedupinputs" decides before any output C file exists.
+*
+*  Member(s)
+*
+*  pool:      pointer to the shared pool, which holds every chunk of the pooled
+*             input binary files once
+*  poolsize:  the number of bytes of the shared pool
+*  origins:   pointer to the index, per input binary file, of the first input
+*             binary file with the same data (i.e.: its own index, unless it is
+*             a duplicate)
+*  tables:    pointer to the chunk table, per input binary file, which is "NULL"
+*             unless the input binary file shares chunks with others (and is
+*             not a duplicate)
+*  counts:    pointer to the number of elements of each chunk table
+*  sizes:     pointer to the size, per input binary file, in bytes
+*/
+
+typedef struct
+{
+    unsigned char * restrict   pool;
+    unsigned long              poolsize;
+    int * restrict             origins;
+    unsigned long * * restrict tables;
+    unsigned long * restrict   counts;
+    unsigned long * restrict   sizes;
+} main_dedup;
+
+
+
+/*
+** main_chunk type
+*
+*  This type describes a unique chunk of the input binary files, which
+*  "main_dedupinputs" finds with content-defined chunking.
+*
+*  Member(s)
+*
+*  hash:    the hash of the chunk's data
+*  offset:  the offset of the chunk's data among the unique chunks' data
+*  size:    the number of bytes of the chunk
+*  owner:   the index of the last input binary file to count the chunk, plus
+*           one
+*  refs:    the number of input binary files that have the chunk
+*  placed:  the offset of the chunk in the shared pool, plus one, or zero while
+*           the shared pool does not have it
+*/
+
+typedef struct
+{
+    unsigned long hash;
+    size_t        offset;
+    size_t        size;
+    unsigned long owner;
+    unsigned long refs;
+    unsigned long placed;
+} main_chunk;
+
+
+
+/*
+** main_entry type
+*
+*  This type describes an input binary file in the pack of the "-u" option,
+*  which "main_runpack" sorts by the hash of the input binary file's name, or
+*  in the pack file of the "-f" option.
+*
+*  Member(s)
+*
+*  hash:    the hash of the input binary file's name, with the extension (zero
+*           in the pack file of the "-f" option)
+*  offset:  the offset of the input binary file's data in the pack
+*  size:    the number of bytes of the input binary file
+*  name:    pointer to the name of the input binary file, with the extension
+*           (without it in the pack file of the "-f" option, whose accessors
+*           are named after it)
+*/
+
+typedef struct
+{
+    unsigned long         hash;
+    unsigned long         offset;
+    unsigned long         size;
+    char const * restrict name;
+} main_entry;
+
+
+
 /*
 ** main_outputusage function
 *
@@ -228,13 +934,21 @@ static bool main_outputusage
         int error;
 
         error = fprintf ( stderr,
-                          "%s <input_file> [-p <array_prefix>] [-s <array_suffix>] [-g <length_suffix>]\n\n",
+                          "%s <input_file> [<input_file> ...] [-p <array_prefix>] [-s <array_suffix>]\n"  \
+                          "                [-g <length_suffix> | -l <length_suffix>] [-e <end_suffix>] [-m <mode>] [-j <shard_size>]\n"  \
+                          "                [-b <bytes_per_line> [-n <offset_lines>]] [-a <alignment>] [-x <section>] [-y <pool> | -v <base_file>]\n"  \
+                          "                [-z <padding>] [-h <hole_size>] [-c <codec> [-w <window>] [-d <dictionary>] [-q <cache>]] [-k <block_size>]\n",
                           program );
         success &= error >= 0;
 
+        error =    fputs ( "                [-u <pack> [-i <lookup>]] [-f <mapped_pack>] [-o <trace_file>] [-r <reload_macro>] [-t <type>]\n\n",
+                           stderr );
+        success &= error >= 0;
+
         error =    fputs ( "  input_file        Specifies the input file to use as the source of binary data.  The output file(s) will have the\n"    \
                            "                    input file's path and name, but with the \".h\" extension and, when the \"-g\" option is present,\n"  \
-                           "                    the \".c\" extension.  The input file's name also serves as the core of the name of the array.\n",
+                           "                    the \".c\" extension.  The input file's name also serves as the core of the name of the array.\n"   \
+                           "                    Each of several input files becomes an array of its own, with the same options.\n",
                            stderr );
         success &= error >= 0;
 
@@ -253,7 +967,263 @@ static bool main_outputusage
                            stderr );
         success &= error >= 0;
 
-    }
+        error =    fputs ( "  -l length_suffix  Gives the name global scope like \"-g\", but declares the number of elements as an \"extern size_t\n"  \
+                           "                    const\" named \"array_prefix\", the input file's name and \"length_suffix\", which the source file\n"    \
+                           "                    defines.  The header file then only depends on the names, so it is left untouched when only the\n"     \
+                           "                    input file's data changes and files that include it merely need to be relinked.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -e end_suffix     Declares a pointer to one past the last element named \"array_prefix\", the input file's name\n"  \
+                           "                    and \"end_suffix\".  This option requires the \"-g\" or \"-l\" option.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -m mode           Selects the form of the output file(s).  The \"inline\" mode creates only a self-contained header\n"  \
+                           "                    file whose array has global scope, yet a single definition survives linking: \"inline constexpr\"\n"  \
+                           "                    in C++17 and weak (or \"selectany\") symbols in C.  This option excludes \"-g\" and \"-l\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The \"constexpr\" mode creates only a C++17 header file whose array is an \"inline constexpr\"\n"     \
+                           "                    \"std::array\" of 64-bit words, with \"constexpr\" accessors of bytes and words, for compile-time\n"  \
+                           "                    processing.  It also excludes \"-c\", \"-h\", \"-u\", \"-v\" and \"-y\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The \"module\" mode creates a C++20 module interface unit (\"<input_file>.cppm\") instead,\n"  \
+                           "                    named like the array, which exports the array and its size (with the \"_size\" suffix),\n"  \
+                           "                    so its initializer is only parsed once.  It excludes the same options as \"constexpr\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The \"columns\" mode transposes the records of the \"-t\" option's layout into an array per\n"  \
+                           "                    field, named after the field, instead of an array of structures.  It requires \"-t\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The \"text\" mode creates only a header file whose array is a null-terminated string literal,\n"  \
+                           "                    a line per line of the input file, with a \"_length\" macro that excludes the terminator\n"       \
+                           "                    and, in C++17, a \"std::string_view\" with the \"_view\" suffix.  The \"lines\" mode adds a\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    \"_lines\" array of the offsets at which the lines start.  They exclude \"-j\", \"-n\", \"-z\",\n"  \
+                           "                    \"-h\", \"-c\", \"-k\", \"-y\", \"-v\", \"-u\", \"-f\", \"-r\" and \"-t\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -j shard_size     Splits the array's definition into source files (\"<input_file>.0.c\", \"<input_file>.1.c\", etc.)\n"  \
+                           "                    of \"shard_size\" bytes each (with an optional \"k\" or \"m\" multiplier), so they compile in\n"     \
+                           "                    parallel.  The shards share a section, in which an ELF linker places them contiguously when\n"          \
+                           "                    linked in order, and the header file declares the whole array.  This option requires \"-g\" or\n"    \
+                           "                    \"-l\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The size is rounded up to a multiple of 64 bytes (or of \"-a\"), and the shards that\n"  \
+                           "                    an earlier run numbered beyond the last shard are removed.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -b bytes_per_line Wraps the array's initializer after every \"bytes_per_line\" elements.  If this option is not\n"  \
+                           "                    present, then the whole initializer is on a single line.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -n offset_lines   Precedes every \"offset_lines\"-th line of the wrapped initializer with a comment\n"  \
+                           "                    that states the offset of the line's first element.  This option requires \"-b\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -a alignment      Aligns the array to \"alignment\" bytes, which must be a power of two, or to a \"page\" (4096\n"  \
+                           "                    bytes) or a \"hugepage\" (2097152 bytes, which exceeds the 8192 bytes that Microsoft's\n"         \
+                           "                    compilers accept).\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -x section        Places the array in the named section.  This option excludes \"-j\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -z padding        Appends \"padding\" zero bytes to the array, which the number of elements that \"-g\", \"-l\"\n"  \
+                           "                    and \"-e\" express excludes (unlike \"sizeof\"), so that vectorized code can safely read past\n"  \
+                           "                    the end of the data.  Without \"-g\" and \"-l\", a \"_SIZE\" macro states the data's size.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -h hole_size      Leaves runs of at least \"hole_size\" zero bytes (with an optional \"k\" or \"m\" multiplier),\n"  \
+                           "                    and any trailing zero bytes, out of the initializer, which static initialization fills in.\n"   \
+                           "                    The array then states its number of elements and the element after a hole designates its\n"  \
+                           "                    index, which needs C99 or later (but not C++).  The holes of sparse files are not read.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -c codec          Compresses the array's data.  The \"lz\" codec outputs the LZ4 block format, declares the\n"          \
+                           "                    decoded size as \"array_prefix\", the input file's name and \"_decoded\" (capitalized, unless\n"  \
+                           "                    \"-l\" is present), and creates the \"bin2c_lz.h\" header file, whose functions decode the data\n"   \
+                           "                    into a caller-provided buffer, or in pieces through a small window.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The \"auto\" codec decides between \"lz\" and storing the data for every input file, from\n"  \
+                           "                    its format and entropy, and reports the decision on the standard error.  Every array has\n"   \
+                           "                    the decoded size (its own size, when stored), and a \"_COMPRESSED\" macro, or constant\n"     \
+                           "                    with \"-l\", is 1 or 0, so the header file does not depend on the decision.\n"                \
+                           "                    This option excludes \"-z\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -w window         Limits how far back the compressed data refers to \"window\" bytes (a power of two from 16 to\n"  \
+                           "                    64k, which is the default), which is the size of the window that a streaming decode needs.\n"     \
+                           "                    This option requires \"-c\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -k block_size     Compresses every \"block_size\" bytes (with an optional \"k\" or \"m\" multiplier) of the input\n"  \
+                           "                    file independently and defines a block index and a \"bin2c_lz_blob\" named \"array_prefix\",\n"     \
+                           "                    the input file's name and \"_blocks\" or \"_blob\", with which \"bin2c_lz_range\" decodes\n"        \
+                           "                    just the blocks that hold a range of bytes, which requires \"-c\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    An item of \"crc32c:\" and a size, instead of the block size or after it and a comma, hashes\n"   \
+                           "                    the input file's data with CRC32C, whole and every that many bytes, and defines the\n"            \
+                           "                    checksum as the array's name and \"_crc32c\" (capitalized, unless \"-l\" is present), and the\n"  \
+                           "                    blocks' checksums and a \"bin2c_crc_index\" named like it but with \"_hashes\" or \"_crc\",\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    with which the \"bin2c_crc.h\" header file's function verifies just the blocks that hold a\n"  \
+                           "                    range of bytes (e.g.: \"64k,crc32c:4k\").  This option excludes \"-y\" and \"-v\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -d dictionary     Trains a dictionary on what the input files have in common and outputs it once, next to the\n"   \
+                           "                    first input file, as an array named \"dictionary\" (with the prefix and suffix, and a \"_size\"\n"  \
+                           "                    macro unless \"-g\" or \"-l\" is present).  Every compressed array refers back into it, so the\n"  \
+                           "                    \"_dict\" functions of \"bin2c_lz.h\" decode them.  This option requires \"-c\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -q cache          Defines a function per compressed array, named like it but with the \"_cached\" suffix\n"   \
+                           "                    (instead of \"array_suffix\"), that returns its decoded data as a \"bin2c_cache_span\" from\n"  \
+                           "                    a cache named \"cache\" (with the prefix and suffix), which the \"<cache>.h\" and \".c\" files\n"  \
+                           "                    (next to the first input file) declare and define.  The \"bin2c_cache.h\" header file's\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    functions decode on a miss, and evict the least recently used data beyond a budget of\n"    \
+                           "                    16m bytes (or the \"<CACHE>_BUDGET\" macro's), thread-safely.  \"bin2c_cache_release\"\n"  \
+                           "                    unpins the data.  This option requires \"-c\" and excludes \"-g\", \"-l\" and \"-j\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -y pool           Outputs the data of identical input files once: the header files of later ones only alias\n"  \
+                           "                    the first one's names (and include its header file, which must be on the include path),\n"    \
+                           "                    with a pointer for the array and macros for the other names, which replace those names\n"     \
+                           "                    anywhere after the header file.  Without \"-g\", \"-l\" and \"-m\", the data is repeated.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    The chunks that input files have in common form an array named \"pool\", like \"-d\" does, and\n"  \
+                           "                    each of those input files only has a table of its chunks, named \"array_prefix\", the input\n"  \
+                           "                    file's name and \"_chunks\", whose data \"bin2c_pool.h\" reassembles.  This option excludes \"-c\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -v base_file      Outputs \"base_file\" once, as an array named after it (like \"-d\" does, next to it), and\n"       \
+                           "                    every input file as a delta against it, with the decoded size like \"-c\" does.  The\n"            \
+                           "                    \"bin2c_delta.h\" header file's functions apply a delta to the base, whole or in pieces.\n"          \
+                           "                    This option excludes \"-c\", \"-z\" and \"-y\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -u pack           Outputs all input files as a single array named \"pack\" (like \"-d\" does), with every\n"          \
+                           "                    input file's data aligned to 16 bytes, instead of an array each.  The \"<pack>_index.h\"\n"       \
+                           "                    header file defines the offsets and sizes of the input files' data and the hashes of their\n"     \
+                           "                    names, as arrays without pointers, and a macro per input file for its entry, named \"pack\"\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    and the input file's name.  The \"bin2c_pack.h\" header file's function finds an entry by\n"  \
+                           "                    name.  In C++20, the \"consteval\" function \"bin2c::get\" resolves a name to a \"std::span\"\n"  \
+                           "                    of the input file's data at compile time.  This option excludes \"-c\", \"-y\" and \"-v\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -i lookup         Orders the pack's index by a minimal perfect hash of the input files' names, which the\n"   \
+                           "                    index header file defines a \"lookup\" function for.  The function takes a name and its\n"  \
+                           "                    length, and returns the entry with one hash and one comparison of names, or\n"               \
+                           "                    \"BIN2C_PACK_NONE\".  The index then has the names instead of the sorted hashes.  This\n"    \
+                           "                    option requires \"-u\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -f mapped_pack    Writes all input files' data into the \"<mapped_pack>.bin\" file (next to the first input\n"   \
+                           "                    file), for data too large to link, instead of arrays.  The \"<mapped_pack>.h\" and \".c\"\n"    \
+                           "                    files declare and define a function per input file, named like its array, that returns\n"     \
+                           "                    its data as a \"bin2c_mmap_span\".  The \"bin2c_mmap.h\" header file's functions map the\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    pack file into memory on first use, thread-safely, after checking that its size and the\n"    \
+                           "                    stamp at its start match the C file's, which hold the size and hash of the data when it\n"    \
+                           "                    was written (the data itself is not hashed again, so this catches a stale or foreign pack\n"  \
+                           "                    file, but not a corrupted one).  This option only permits \"-p\" and \"-s\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -o trace_file     Orders the input files in the pack by \"trace_file\", which names them (with or without\n"    \
+                           "                    the extension) a line each, in the order of first access at startup.  The named input\n"    \
+                           "                    files come first, and the others follow from the next page on.  A function with the\n"     \
+                           "                    \"_willneed\" suffix, named after the pack, advises the system to page the named input\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    files in ahead of use (e.g.: with \"madvise\").  Names of no input file are reported on the\n"  \
+                           "                    standard error.  This option requires \"-u\" or \"-f\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -r reload_macro   Lets the header file resolve the array's name to the input file's current data, when\n"    \
+                           "                    \"reload_macro\" is defined, which the \"bin2c_reload.h\" header file's functions copy\n"  \
+                           "                    from the input file's full pathname and copy again once it changes, for development\n"     \
+                           "                    builds.  Otherwise, the array holds the data as usual.  Both define a \"_size\" macro\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    and a \"_span\" one, which holds the data and its size from the same version.\n"  \
+                           "                    This option excludes \"-g\", \"-l\", \"-m\", \"-c\", \"-h\", \"-y\", \"-v\", \"-u\" and \"-f\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "  -t type           Declares the array's elements of \"type\" instead of bytes: \"int8\", \"uint8\", \"int16\",\n"     \
+                           "                    \"uint16\", \"int32\", \"uint32\", \"int64\", \"uint64\" (the \"<stdint.h>\" types), \"float\" or\n"  \
+                           "                    \"double\", optionally followed by the input file's byte order, \"le\" (the default) or \"be\"\n"    \
+                           "                    (e.g.: \"int16be\").  The header file converts every element to a literal of that type\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    and needs C99 or C++ (or C++17 for the hexadecimal floating-point literals, which\n"                                  \
+                           "                    round-trip exactly).  The input file's size must be a multiple of the type's size.  This\n"                           \
+                           "                    option excludes \"-g\", \"-l\", \"-m\" (but \"columns\"), \"-j\", \"-z\", \"-h\", \"-c\", \"-k\", \"-y\", \"-v\",\n"  \
+                           "                    \"-u\", \"-f\" and \"-r\".\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    Otherwise, \"type\" is the layout of the input file's records: fields (\"name:type\") and\n"     \
+                           "                    padding (in bytes), separated by commas or spaces (e.g.: \"id:uint32be,4,x:float,y:float\"),\n"  \
+                           "                    or \"@\" and the pathname of a schema file that holds it (where \"#\" starts a comment).\n"      \
+                           "                    The array's elements are then structures (with the \"_record\" suffix), or columns.\n",
+                           stderr );
+        success &= error >= 0;
+
+        error =    fputs ( "                    A field's name must be a C identifier, but no keyword of C or C++ (e.g.: \"int\" or \"new\").\n",
+                           stderr );
+        success &= error >= 0;
+
+    }
 
     return ( success );
 }
@@ -501,6 +1471,103 @@ static char * restrict main_runbin2c_constructmacro
 
 
 
+/*
+** main_hashdata function
+*
+*  This function hashes data (e.g.: a chunk of an input binary file, a whole
+*  input binary file or a name) with the 32-bit FNV-1a hash.
+*
+*  Parameter(s)
+*
+*  data:  pointer to the data to hash
+*  size:  number of bytes to hash
+*
+*  Return value(s)
+*
+*  The hash, which is less than "1 << 32".
+*/
+
+static unsigned long main_hashdata
+(
+    unsigned char const * restrict data,
+    size_t                         size
+)
+{
+    unsigned long hash;
+    size_t        index;
+
+    hash = 2166136261ul;
+
+    for ( index = 0; index < size; index += 1u )
+    {
+        hash ^= ( unsigned long ) data[index];
+        hash =  ( hash * 16777619ul ) & 0xFFFFFFFFul;
+    }
+
+    return ( hash );
+}
+
+
+
+/*
+** main_constructname function
+*
+*  This function concatenates the parts of a name, like "main_runbin2c_
+*  outputsymbol" outputs them, into a heap allocation.  The caller must use
+*  the "free" function to release the heap allocation.
+*
+*  Parameter(s)
+*
+*  prefix:  pointer to the prefix, or "NULL"
+*  core:    pointer to the core of the name
+*  suffix:  pointer to the suffix, or "NULL"
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; the heap allocation failed
+*  !=NULL:  success; pointer to the name (the caller must release this heap
+*           allocation)
+*/
+
+static char * restrict main_constructname
+(
+    char const * restrict prefix,
+    char const * restrict core,
+    char const * restrict suffix
+)
+{
+    char * restrict name;
+    size_t          length;
+
+    length = strlen ( core ) + 1u;
+
+    if ( prefix != NULL )
+    {
+        length += strlen ( prefix );
+    }
+
+    if ( suffix != NULL )
+    {
+        length += strlen ( suffix );
+    }
+
+    name = ( char * ) malloc ( sizeof ( *name ) * length );
+
+    if ( name != NULL )
+    {
+        strcpy ( name,
+                 ( prefix != NULL ) ? prefix : "" );
+        strcat ( name,
+                 core );
+        strcat ( name,
+                 ( suffix != NULL ) ? suffix : "" );
+    }
+
+    return ( name );
+}
+
+
+
 /*
 ** main_runbin2c_outputsymbol function
 *
@@ -579,257 +1646,345 @@ static bool main_runbin2c_outputsymbol
 
 
 /*
-** main_runbin2c function
+** main_runbin2c_outputguard function
 *
-*  This is the core function of the program, which only the "main" function
-*  should call, after parsing and validating the command-line arguments.
+*  This function outputs the opening of the header guard of an output header
+*  file.  The caller must output the closing "#endif" at the end of the file.
 *
 *  Parameter(s)
 *
-*  infile:   pointer to the "FILE" object for the input binary file; must be
-*            be opened in "rb" or equivalent mode (but, idealy, not "r+b")
 *  symbol:   pointer to the name of the array (usually the name of the input
 *            binary file, without the leading file path and without the trailing
 *            file extension)
-*  prefix:   optional pointer to the prefix portion of the name of the array
-*            (e.g.: "s_"); may be "NULL"
-*  suffix:   optional pointer to the suffix portion of the name of the array
-*            (e.g.: "_data"); may be "NULL"
-*  global:   optional pointer to the suffix portion of the name of the length
-*            of the array (e.g.: "_length"); may be "NULL"
-*  outpath:  pointer to the pathname for the output files; a single-character
-*            extension must be present, which this function will replace with
-*            "h" and, potentially, "c", in the process of creating the array
+*  outfile:  pointer to the "FILE" object for the output header file
 *
 *  Return value(s)
 *
 *  ==false:  failure; an error occurred and the output file likely is in an
 *            incomplete form
-*  !=false:  success; the output file has the array of binary data
-*
-*  Remarks
-*
-*  This function assumes that the caller, which should be "main", has already
-*  performed all necessary validation (e.g.: "binfile" is readable in binary
-*  form, "symbol" is a valid symbol name, etc.).  Deviations from this
-*  function's assumptions can result in incomplete data and/or an uncompilable
-*  header and/or source file.
+*  !=false:  success; the output file has the opening of the header guard
 */
 
-static bool main_runbin2c
+static bool main_runbin2c_outputguard
 (
-    FILE * restrict       infile,
     char const * restrict symbol,
-    char const * restrict prefix,
-    char const * restrict suffix,
-    char const * restrict global,
-    char * restrict       outpath
+    FILE * restrict       outfile
 )
 {
-    bool   success;
-    size_t offset;
-    long   length;
-
-    success = true;
+    bool            success;
+    char * restrict macro;
 
-    /*
-    ** The last character of "outpath" is the whitespace that this function
-    *  replaces with "h" and, potentially, "c" to create the C output files.
-    */
+    macro =   main_runbin2c_constructmacro ( NULL,
+                                             symbol,
+                                             NULL );
+    success = macro != NULL;
 
     if ( success )
     {
-        offset =  strlen ( outpath );
-        success = offset >= 1u;
-        offset -= 1u;
-    }
+        int error;
 
-    /*
-    ** In the context of this converter, the purpose of naming the array is to
-    *  avoid name collision.  Hence, the name has the option to have a prefix
-    *  and suffix.  That means names such as "g_filename_data" are possible.
-    *  (The "filename" portion is the input binary file name, excluding the path
-    *  and extension, which leverages any name anti-collision happening among
-    *  the source files in a project).
-    */
+        error =   fprintf ( outfile,
+                            "#if !defined ( __%s_H__ )\n\n#define __%s_H__\n\n",
+                            macro,
+                            macro );
+        success = error >= 0;
 
-    {
-        FILE * restrict outfile;
+        free ( macro );
 
-        outfile = NULL;
+    }
 
-        if ( success )
-        {
+    return ( success );
+}
 
-            outpath[offset] = ( global != NULL ) ? 'c' : 'h';
 
-            outfile = fopen ( outpath,
-                              "wt" );
-            success = outfile != NULL;
 
-        }
+/*
+** main_runbin2c_outputinline function
+*
+*  This function outputs the storage-class specifiers that precede the array
+*  definition in the "inline" form of the output header file.
+*
+*  Parameter(s)
+*
+*  outfile:  pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the specifiers
+*
+*  Remarks
+*
+*  The specifiers give the array a single definition despite every translation
+*  unit that includes the header file defining it.  C++17 has "inline" variables
+*  for that purpose, while C relies on extensions: Microsoft's "selectany" and
+*  the weak symbols of GCC-compatible compilers.  (For C++ before C++17, the
+*  "extern" keyword is necessary because namespace-scope constants otherwise
+*  have internal linkage.)  Either way, the array type remains complete, so the
+*  "sizeof" operator still yields the number of elements.
+*/
 
-        /*
-        ** If the name has global scope, then the definition of the array must
-        *  reside in a source file.  Otherwise, the definition of the array must
-        *  reside in a header file and the name must have static scope.
-        *  Therefore, this function creates either a source or header file for
-        *  the array definition, based on the name's scope.
-        */
+static bool main_runbin2c_outputinline
+(
+    FILE * restrict outfile
+)
+{
+    int error;
+
+    error = fputs ( "#if ( defined ( __cplusplus ) && ( __cplusplus >= 201703l ) ) || ( defined ( _MSVC_LANG ) && ( _MSVC_LANG >= 201703l ) )\n"  \
+                    "inline constexpr\n"                      \
+                    "#elif defined ( _MSC_VER )\n"            \
+                    "__declspec ( selectany ) extern\n"       \
+                    "#elif defined ( __cplusplus )\n"         \
+                    "extern __attribute__ ( ( weak ) )\n"     \
+                    "#else\n"                                 \
+                    "__attribute__ ( ( weak ) )\n"            \
+                    "#endif\n",
+                    outfile );
+
+    return ( error >= 0 );
+}
 
-        if ( success )
-        {
-            int error;
 
-            if ( global != NULL )
-            {
-                error =    fprintf ( outfile,
-                                     "#include \"%s.h\"\n\n",
-                                     symbol );
-                success &= error >= 0;
-            }
-            else
-            {
-                error =   fputs ( "static ",
-                                  outfile );
-                success &= error >= 0;
-            }
-            {
-                error =  fputs ( "unsigned char const ",
-                                 outfile );
-                success &= error >= 0;
-            }
 
-        }
+/*
+** main_runbin2c_outputplacement function
+*
+*  This function outputs the alignment and section specifiers of the "-a" and
+*  "-x" options, which precede the array's declaration or definition.
+*
+*  Parameter(s)
+*
+*  arguments:   pointer to the parameters of the command-line options
+*  definition:  whether the specifiers precede the definition of the array (as
+*               opposed to an "extern" declaration, which only needs to convey
+*               the alignment)
+*  outfile:     pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the specifiers, if any
+*
+*  Remarks
+*
+*  The standard alignment specifiers ("alignas" in C++11 and "_Alignas" in C11)
+*  take precedence over the compilers' extensions.  All of them are valid at the
+*  start of a declaration, ahead of any storage-class specifiers.  Microsoft's
+*  compilers need the section declared with "#pragma section" before they can
+*  allocate anything in it.  Note that Microsoft's compilers limit alignment to
+*  "MAIN_MSVCALIGNMENT" bytes, so page alignment is fine, but huge-page
+*  alignment is not, which an "#error" directive reports to them.
+*/
 
-        if ( success )
-        {
+static bool main_runbin2c_outputplacement
+(
+    main_arguments const * restrict arguments,
+    bool                            definition,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
 
-            {
-                int error;
+    success = true;
 
-                error =    main_runbin2c_outputsymbol ( prefix,
-                                                        symbol,
-                                                        suffix,
-                                                        outfile );
-                success &= error >= 0;
+    /*
+    ** An alignment beyond what Microsoft's compilers accept stops them
+    *  instead, rather than silently aligning the array less.
+    */
 
-            }
+    if ( ( arguments->alignment != NULL ) && ( arguments->alignsize > MAIN_MSVCALIGNMENT ) )
+    {
+        int error;
 
-            {
-                int error;
+        error =    fprintf ( outfile,
+                             "#if defined ( _MSC_VER )\n"                                                    \
+                             "#error \"Microsoft's compilers limit alignment to %lu bytes.\"\n"              \
+                             "#endif\n",
+                             ( unsigned long ) MAIN_MSVCALIGNMENT );
+        success &= error >= 0;
 
-                error =    fputs ( "[] = { ",
-                                   outfile );
-                success &= error >= 0;
+    }
 
-            }
+    if ( arguments->alignment != NULL )
+    {
+        int error;
 
-        }
+        error =    fprintf ( outfile,
+                             "#if defined ( __cplusplus ) && ( __cplusplus >= 201103l )\n"                   \
+                             "alignas ( %lu )\n"                                                             \
+                             "#elif defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112l )\n"       \
+                             "_Alignas ( %lu )\n"                                                            \
+                             "#elif defined ( _MSC_VER )\n"                                                  \
+                             "__declspec ( align ( %lu ) )\n"                                                \
+                             "#else\n"                                                                       \
+                             "__attribute__ ( ( aligned ( %lu ) ) )\n"                                       \
+                             "#endif\n",
+                             arguments->alignsize,
+                             arguments->alignsize,
+                             arguments->alignsize,
+                             arguments->alignsize );
+        success &= error >= 0;
 
-        /*
-        ** This converter attempts to efficiently read from the input binary file in
-        *  large chunks that are potentially multiples of the page size.  This
-        *  approach facilitates some file systems' caching behavior that auto-
-        *  selects unbuffered reads, which, importantly, amortizes time lost to
-        *  media access and can eliminate in-memory copying. (Therefore, using the
-        *  "r+b" mode is not ideal as the potential for writing may prevent
-        *  unbuffered reading.)   Conversely, this converter attempts to efficiently
-        *  write to the output C file in small chunks in an attempt to induce the
-        *  file systems' caching to use buffered writes which, importantly, means
-        *  flushing to stable media in the background.  (Therefore, using the "w+t"
-        *  mode is not ideal as it may delay including pages in flushes.)
-        */
+    }
 
-        {
-            char const * restrict    format;
-            unsigned char * restrict buffer;
+    if ( definition && ( arguments->section != NULL ) )
+    {
+        int error;
 
-            CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+        error =    fprintf ( outfile,
+                             "#if defined ( _MSC_VER )\n"                                                    \
+                             "#pragma section ( \"%s\", read )\n"                \
+                             "__declspec ( allocate ( \"%s\" ) )\n"              \
+                             "#else\n"                                           \
+                             "__attribute__ ( ( section ( \"%s\" ) ) )\n"        \
+                             "#endif\n",
+                             arguments->section,
+                             arguments->section,
+                             arguments->section );
+        success &= error >= 0;
 
-            length = 0;
+    }
 
-            #if defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l )
-            format =  "0x%hhXu";
-            #else
-            format =  "0x%hXu";
-            #endif
+    return ( success );
+}
 
-            buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
-            success = buffer != NULL;
 
-            while ( success )
-            {
-                size_t count;
 
-                count = fread ( buffer,
-                                sizeof ( *buffer ),
-                                MAIN_CHUNKSIZE,
-                                infile );
-                if ( count < 1u )
-                {
-                    if ( ferror ( infile ) )
-                    {
-                        success = false;
-                    }
-                }
+/*
+** main_runbin2c_commitfile function
+*
+*  This function copies the content of a staged temporary file into the file at
+*  the given pathname, but only when the existing file's content differs from
+*  the staged content (or when there is no existing file).
+*
+*  Parameter(s)
+*
+*  staged:   pointer to the "FILE" object for the staged content; must be opened
+*            in "w+b" or equivalent mode (e.g.: as "tmpfile" does)
+*  outpath:  pointer to the pathname of the file to create or replace
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the staged content
+*
+*  Remarks
+*
+*  Build systems typically decide what to rebuild by comparing modification
+*  times.  Therefore, leaving a header file untouched when its content has not
+*  changed avoids recompiling every source file that includes it.  Since the
+*  output files are text files, the existing file is read and the staged content
+*  is written in text mode, which keeps line endings consistent with the other
+*  output files on systems that translate them.
+*/
 
-                if ( success )
-                {
-                    unsigned char const * data;
+static bool main_runbin2c_commitfile
+(
+    FILE * restrict       staged,
+    char const * restrict outpath
+)
+{
+    bool                     success;
+    bool                     same;
+    unsigned char * restrict buffer;
 
-                    data = buffer;
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) / 2u ) >= MAIN_CHUNKSIZE );
 
-                    while ( count > 0 )
-                    {
-                        int error;
+    buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE * 2u );
+    success = buffer != NULL;
+    same =    false;
 
-                        error = fprintf ( outfile,
-                                          format,
-                                          #if defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l )
-                                          ( unsigned char ) *data );
-                                          #else
-                                          ( unsigned short ) *data );
-                                          #endif
-                        success &= error >= 0;
+    /*
+    ** Comparing the staged content with the existing file's content happens
+    *  in chunks, which stops at the first difference.  A missing existing file
+    *  simply counts as a difference.
+    */
 
-                        success &= length < LONG_MAX;
-                        length +=  1ul;
+    if ( success )
+    {
+        FILE * restrict infile;
 
-                        #if defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l )
-                        format =  ", 0x%hhXu";
-                        #else
-                        format =  ", 0x%hXu";
-                        #endif
+        rewind ( staged );
 
-                        count -= 1u;
-                        data +=  1u;
+        infile = fopen ( outpath,
+                         "rt" );
+        same =   infile != NULL;
 
-                    }
+        while ( same )
+        {
+            size_t count;
+            size_t other;
+
+            count = fread ( buffer,
+                            sizeof ( *buffer ),
+                            MAIN_CHUNKSIZE,
+                            staged );
+            other = fread ( buffer + MAIN_CHUNKSIZE,
+                            sizeof ( *buffer ),
+                            MAIN_CHUNKSIZE,
+                            infile );
+
+            same &= count == other;
+            same &= memcmp ( buffer,
+                             buffer + MAIN_CHUNKSIZE,
+                             count ) == 0;
+
+            if ( count < MAIN_CHUNKSIZE )
+            {
+                same &= !ferror ( staged ) && !ferror ( infile );
+                break;
+            }
 
-                }
+        }
 
-                if ( feof ( infile ) )
-                {
-                    break;
-                }
+        if ( infile != NULL )
+        {
+            fclose ( infile );
+        }
 
-            }
+    }
 
-            if  ( buffer != NULL )
-            {
-                free ( buffer );
-            }
+    /*
+    ** Copying the staged content is only necessary when the existing file's
+    *  content differs, in which case the whole file is rewritten.
+    */
 
-        }
+    if ( success && !same )
+    {
+        FILE * restrict outfile;
 
-        if ( success )
+        rewind ( staged );
+
+        outfile = fopen ( outpath,
+                          "wt" );
+        success = outfile != NULL;
+
+        while ( success )
         {
-            int error;
+            size_t count;
 
-            error =   fputs ( " };\n",
-                              outfile );
-            success = error >= 0;
+            count = fread ( buffer,
+                            sizeof ( *buffer ),
+                            MAIN_CHUNKSIZE,
+                            staged );
+            success &= !ferror ( staged );
+
+            if ( count > 0 )
+            {
+                success &= fwrite ( buffer,
+                                    sizeof ( *buffer ),
+                                    count,
+                                    outfile ) == count;
+            }
+
+            if ( count < MAIN_CHUNKSIZE )
+            {
+                break;
+            }
 
         }
 
@@ -839,7 +1994,6 @@ static bool main_runbin2c
 
             error =    fflush ( outfile );
             success &= error >= 0;
-
             error =    fclose ( outfile );
             success &= error >= 0;
 
@@ -847,450 +2001,14597 @@ static bool main_runbin2c
 
     }
 
-    /*
-    ** If the name has global scope, then its definition resides in a source
-    *  file and its declaration resides in a header file.  (For static scope,
-    *  the definition resides in a header file and also serves as the name
-    *  declaration.)  Additionally, global scope obscures the array's size.
-    *  Therefore, the header file also has a macro that expresses the number of
-    *  elements in the array.
-    */
-
-    if ( global )
+    if ( buffer != NULL )
     {
-        FILE * restrict outfile;
+        free ( buffer );
+    }
 
-        outfile = NULL;
+    return ( success );
+}
 
-        if ( success )
-        {
 
-            outpath[offset] = 'h';
 
-            outfile = fopen ( outpath,
-                              "wt" );
-            success = outfile != NULL;
+/*
+** main_runbin2c_measurerun function
+*
+*  This function measures the run of a constant byte at the start of some data,
+*  which the "-h" option's holes and the "-c" option's run-length records are.
+*
+*  Parameter(s)
+*
+*  data:   pointer to the bytes to measure
+*  count:  number of bytes to measure
+*  value:  the constant byte
+*
+*  Return value(s)
+*
+*  The number of leading bytes that equal "value" (which is "count" when all of
+*  them do).
+*
+*  Remarks
+*
+*  Runs in flash images and other padded data are often thousands of bytes
+*  long, so this function compares a whole "unsigned long" at a time against the
+*  byte replicated across one, and only the run's end byte by byte.  Copying
+*  each word out of the data keeps that portable to processors that require
+*  aligned words, and compilers turn the copy into a plain load where they can.
+*/
 
-        }
+static size_t main_runbin2c_measurerun
+(
+    unsigned char const * restrict data,
+    size_t                         count,
+    unsigned char                  value
+)
+{
+    unsigned long pattern;
+    unsigned long word;
+    size_t        run;
 
-        if ( success )
+    pattern = ( ULONG_MAX / UCHAR_MAX ) * value;
+    run =     0;
+
+    while ( ( count - run ) >= sizeof ( word ) )
+    {
+
+        memcpy ( &word,
+                 data + run,
+                 sizeof ( word ) );
+
+        if ( word != pattern )
         {
-            char * restrict macro;
+            break;
+        }
 
-            macro =   main_runbin2c_constructmacro ( NULL,
-                                                     symbol,
-                                                     NULL );
-            success = macro != NULL;
+        run += sizeof ( word );
 
-            if ( success )
-            {
-                int error;
+    }
 
-                error =   fprintf ( outfile,
-                                    "#if !defined ( __%s_H__ )\n\n#define __%s_H__\n\nextern unsigned char const ",
-                                    macro,
-                                    macro );
-                success = error >= 0;
+    while ( ( run < count ) && ( data[run] == value ) )
+    {
+        run += 1u;
+    }
 
-                free ( macro );
+    return ( run );
+}
 
-            }
 
-        }
 
-        if ( success )
-        {
+/*
+** main_runbin2c_encode function
+*
+*  This function is the encoder, which converts bytes of the input binary file
+*  into the text of the array's initializer values, including the separators,
+*  line breaks and offset comments between them.
+*
+*  Parameter(s)
+*
+*  data:       pointer to the bytes to convert
+*  count:      number of bytes to convert
+*  position:   index of the first byte in the current array (i.e.: the current
+*              shard, with the "-j" option), which decides the separators
+*  offset:     index of the first byte in the whole array, which the offset
+*              comments state
+*  designated: whether the first byte follows a hole of the "-h" option, so
+*              that its element designates its index
+*  arguments:  pointer to the parameters of the command-line options
+*  text:       pointer to the buffer that receives the text; must have room for
+*              "MAIN_ENCODEDSIZE" characters per byte, and for one more byte
+*              with "designated"
+*
+*  Return value(s)
+*
+*  The number of characters placed in "text" (without a null-terminating
+*  character).
+*
+*  Remarks
+*
+*  The encoder produces the same text as the "0x%hhXu" format would, but uses
+*  a table of hexadecimal digits instead of a formatted output call per byte,
+*  so that the caller can write the text of a whole chunk at once.  Only the
+*  rare offset comments use a formatted output function.
+*/
 
-            {
-                int error;
+static size_t main_runbin2c_encode
+(
+    unsigned char const * restrict  data,
+    size_t                          count,
+    unsigned long                   position,
+    unsigned long                   offset,
+    bool                            designated,
+    main_arguments const * restrict arguments,
+    char * restrict                 text
+)
+{
+    static char const digits[] = "0123456789ABCDEF";
 
-                error =    main_runbin2c_outputsymbol ( prefix,
-                                                        symbol,
-                                                        suffix,
-                                                        outfile );
-                success &= error >= 0;
+    char * restrict cursor;
 
-            }
+    cursor = text;
 
-            {
-                int error;
+    while ( count > 0 )
+    {
+        unsigned char value;
 
-                error =    fputs ( "[];\n\n#define ",
-                                   outfile );
-                success &= error >= 0;
+        /*
+        ** Every element but the first has a preceding separator.  When wrapping
+        *  lines, the first element of a line instead has a line break and
+        *  indentation, and, periodically, an offset comment.
+        */
 
+        if ( ( arguments->lines == NULL ) || ( ( position % arguments->linesize ) != 0 ) )
+        {
+            if ( position > 0 )
+            {
+                cursor[0] = ',';
+                cursor[1] = ' ';
+                cursor +=   2u;
             }
-
         }
-
-        if ( success )
+        else
         {
 
+            if ( position > 0 )
             {
-                char * restrict macro;
+                cursor[0] = ',';
+                cursor[1] = '\n';
+                cursor +=   2u;
+            }
 
-                macro =   main_runbin2c_constructmacro ( prefix,
-                                                         symbol,
-                                                         global );
-                success = macro != NULL;
+            if ( ( arguments->marks != NULL ) && ( ( ( position / arguments->linesize ) % arguments->marksize ) == 0 ) )
+            {
+                cursor += sprintf ( cursor,
+                                    "    /* 0x%08lX */\n",
+                                    offset );
+            }
 
-                if ( success )
-                {
-                    int error;
-
-                    error =   fputs ( macro,
-                                      outfile );
-                    success = error >= 0;
-
-                    free ( macro );
-
-                }
-
-            }
-
-            if ( success )
-            {
-                int error;
-
-                #if defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l )
-                if ( length <= SCHAR_MAX )
-                {
-                    error = fprintf ( outfile,
-                                      "  %hhd",
-                                      ( signed char ) length );
-                }
-                else if ( length <= SHRT_MAX )
-                #else
-                if ( length <= SHRT_MAX )
-                #endif
-                {
-                    error = fprintf ( outfile,
-                                      "  %hd",
-                                      ( short ) length );
-                }
-                else if ( length <= INT_MAX )
-                {
-                    error = fprintf ( outfile,
-                                      "  %d",
-                                      ( int ) length );
-                }
-                else
-                {
-                    error = fprintf ( outfile,
-                                      "  %ldl",
-                                      length );
-                }
-
-                success &= error >= 0;
-
-                error =    fputs ( "\n\n#endif\n",
-                                   outfile );
-                success &= error >= 0;
-
-            }
+            cursor[0] = ' ';
+            cursor[1] = ' ';
+            cursor[2] = ' ';
+            cursor[3] = ' ';
+            cursor +=   4u;
 
         }
 
-        if ( outfile != NULL )
+        if ( designated )
         {
-            int error;
+            cursor +=   sprintf ( cursor,
+                                  "[%lu] = ",
+                                  position );
+            designated = false;
+        }
 
-            error =    fflush ( outfile );
-            success &= error >= 0;
-            error =    fclose ( outfile );
-            success &= error >= 0;
+        value = *data;
+
+        cursor[0] = '0';
+        cursor[1] = 'x';
+        cursor +=   2u;
 
+        if ( value > 0xFu )
+        {
+            *cursor = digits[value >> 4];
+            cursor += 1u;
         }
 
-    }
+        cursor[0] = digits[value & 0xFu];
+        cursor[1] = 'u';
+        cursor +=   2u;
+
+        position += 1u;
+        offset +=   1u;
+        count -=    1u;
+        data +=     1u;
 
-    if ( !success )
-    {
-        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
-                stderr );
     }
 
-    return ( success );
+    return ( ( size_t ) ( cursor - text ) );
 }
 
 
 
 /*
-** main_shortenname function
+** main_outputsupport function
 *
-*  This function a truncates a pathname to remove its file extension.  It also
-*  finds the portion that contains the file name and returns a pointer to that
-*  substring.  This function assumes a prior call of the "main_constructoutname"
-*  function returned successfully.
+*  This function creates (or leaves untouched, when it is current) a support
+*  header file that holds the functions that some options' arrays need, next
+*  to the output C file(s).
 *
 *  Parameter(s)
 *
-*  path:  pointer to the pathname, which may be just the file name
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*  name:     pointer to the file name of the support header file
+*  lines:    pointer to the "NULL"-terminated lines of the support header file
 *
 *  Return value(s)
 *
-*  !=NULL:  pointer to the file name, which does not include the extension
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
 *
 *  Remarks
 *
-*  This function limits the "path" parameter length, including the null-
-*  terminating character, to "USHRT_MAX".  That is rather long for a file path
-*  (at least 65535 characters); so, the limit is simiply a best-effort attempt
-*  at gracefully exiting (instead of causing an access violation exception).
+*  The support header file's content never depends on the input binary file,
+*  so any number of output header files in the same directory share it.  Its
+*  functions have static scope, given that the header file is the only place
+*  that defines them.
 */
 
-static char const * restrict main_shortenname
+static bool main_outputsupport
 (
-    char * restrict path
+    char const * restrict         outpath,
+    char const * restrict         name,
+    char const * const * restrict lines
 )
 {
-    unsigned short terminus;
-    unsigned short delimiter;
+    bool            success;
+    char * restrict path;
+    FILE * restrict outfile;
 
     /*
-    ** Finding the file name and truncating its extension, if any is present,
-    *  depends on finding the last slash character, if any is present.  This
-    *  function assumes that "main_constructoutname" previously return
-    *  successfully and, therefore, does not ensure that the path includes a
-    *  terminating null character (and that there are no more full stops).
+    ** The support header file's pathname is the output files' directory (i.e.:
+    *  the portion of "outpath" before the file name) and the given name.
     */
 
     {
-        unsigned short length;
+        size_t directory;
 
-        CHECK ( sizeof ( length ) <= sizeof ( path ) );
+        directory = ( size_t ) ( main_findname ( outpath ) - outpath );
 
-        length =    USHRT_MAX;
-        terminus =  0;
-        delimiter = 0;
+        CHECK ( ( SIZE_MAX / sizeof ( *path ) ) >= USHRT_MAX );
 
-        while ( length > 0 )
+        path =    ( char * ) malloc ( sizeof ( *path ) * ( directory + strlen ( name ) + 1u ) );
+        success = path != NULL;
+
+        if ( success )
         {
+            memcpy ( path,
+                     outpath,
+                     directory );
+            strcpy ( path + directory,
+                     name );
+        }
 
-            if ( *path == '.' )
-            {
-                terminus = length;
-            }
-            else if ( *path == MAIN_PATHDELIMITER )
-            {
-                terminus =  0;
-                delimiter = ( USHRT_MAX - length ) + 1u;
-            }
-            else if ( *path == '\0' )
-            {
-                break;
-            }
+    }
 
-            length -= 1u;
-            path +=   1u;
+    outfile = NULL;
+
+    if ( success )
+    {
+        outfile = tmpfile ( );
+        success = outfile != NULL;
+    }
+
+    if ( success )
+    {
+        char const * const * line;
+
+        for ( line = lines; success && ( *line != NULL ); line += 1u )
+        {
+            int error;
+
+            error =    fputs ( *line,
+                               outfile );
+            success &= error >= 0;
 
         }
 
-        path -= ( USHRT_MAX - length ) - delimiter;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
 
     }
 
-    /*
-    ** Truncating the pathname to remove the file extension, if any is present,
-    *  is just a simple over-writing of the full stop with a terminating null
-    *  character.  (The file extension remains untouched, albeit invisible.)
-    */
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             path );
+    }
 
-    if ( terminus > 0 )
+    if ( outfile != NULL )
     {
-        terminus =       ( USHRT_MAX - terminus ) - delimiter;
-        path[terminus] = '\0';
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
     }
 
-    return ( path );
+    if ( path != NULL )
+    {
+        free ( path );
+    }
+
+    return ( success );
 }
 
 
 
 /*
-** main_constructoutpath function
+** main_outputliteral function
 *
-*  This function copies the input pathname into a heap allocation and replaces
-*  the input file's extension, if any is present, with a ". " extension so that
-*  the caller can replace the whitespace with C language file extensions.  The
-*  caller must use the "free" function to release the heap allocation.
+*  This function outputs the characters of a name (e.g.: an input binary file's
+*  name or pathname), as the body of a string literal (i.e.: without the
+*  quotation marks).
 *
 *  Parameter(s)
 *
-*  inpath:  pointer to the input pathname, which may be just the file name
+*  name:     pointer to the name
+*  outfile:  pointer to the "FILE" object for the output C file
 *
 *  Return value(s)
 *
-*  ==NULL:  failure; an error occurred, such as "binpath" being too long or
-*           the heap allocation failing
-*  !=NULL:  success; pointer to the output path (the caller must release this
-*           heap allocation)
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the name
 *
 *  Remarks
 *
-*  This function limits the "inpath" parameter length, including the null-
-*  terminating character, to "USHRT_MAX".  That is rather long for a file path
-*  (at least 65535 characters); so, the limit is simiply a best-effort attempt
-*  at gracefully exiting (instead of causing an access violation exception).
+*  Characters other than printable ASCII ones, and the ones that a string
+*  literal or a trigraph would misread, are octal escape sequences of three
+*  digits, so that no character that follows can extend them.
 */
 
-static char * restrict main_constructoutpath
+static bool main_outputliteral
 (
-    char const * restrict inpath
+    char const * restrict name,
+    FILE * restrict       outfile
 )
 {
-    char * restrict outpath;
-    unsigned short  length;
-    unsigned short  offset;
-
-    outpath = NULL;
-
-    /*
-    ** Finding the file extension depends on finding the last full stop, if any
-    *  is present, after finding the last slash delimiter, if any is present.
-    */
-
-    CHECK ( sizeof ( length ) <= sizeof ( inpath ) );
+    bool                           success;
+    unsigned char const * restrict cursor;
 
-    length = USHRT_MAX;
-    offset = USHRT_MAX;
+    success = true;
 
-    while ( length > 0 )
+    for ( cursor = ( unsigned char const * ) name; success && ( *cursor != '\0' ); cursor += 1u )
     {
+        int error;
 
-        if ( *inpath == '.' )
-        {
-            offset = length;
-        }
-        else if ( *inpath == MAIN_PATHDELIMITER )
+        if ( ( *cursor < 0x20u ) || ( *cursor > 0x7Eu ) || ( *cursor == '"' ) || ( *cursor == '\\' ) || ( *cursor == '?' ) )
         {
-            offset = USHRT_MAX;
+            error = fprintf ( outfile,
+                              "\\%03o",
+                              ( unsigned int ) *cursor );
         }
-        else if ( *inpath == '\0' )
+        else
         {
-            break;
+            error = fputc ( *cursor,
+                            outfile );
         }
 
-        length -=  1u;
-        inpath += 1u;
-
+        success = error >= 0;
     }
 
-    /*
-    ** Heap allocation only needs extra capacity of exactly three characters to
-    *  accommodate the output pathname's ". " extension and the null-terminating
-    *  character.
-    */
+    return ( success );
+}
 
-    if ( *inpath == '\0' )
-    {
 
-        inpath -= ( USHRT_MAX - length );
 
-        if ( offset != USHRT_MAX )
-        {
-            length = offset;
-        }
+/*
+** main_runbin2c_outputdecoder function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_lz.h", that holds the decoder of the "-c" option, next to
+*  the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*
+*  Remarks
+*
+*  The decoder is the content of "bin2c_lz.h" verbatim, which
+*  "main_outputsupport" writes like any support header file.
+*/
 
-        CHECK ( ( SIZE_MAX / sizeof ( *outpath ) ) >= USHRT_MAX );
+static bool main_runbin2c_outputdecoder
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c LZ decoder\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-c\" option,\n",
+        "*  which hold LZ4-compatible compressed blocks.  The functions decode the data\n",
+        "*  into caller-provided memory and never allocate from the heap.  With bin2c's\n",
+        "*  \"-k\" option, the blocks are independent and \"bin2c_lz_range\" decodes any\n",
+        "*  range of bytes from only the blocks that hold it.  Defining the\n",
+        "*  \"BIN2C_LZ_THREADS\" macro before including this header file adds\n",
+        "*  \"bin2c_lz_parallel\", which decodes all the blocks with several threads.\n",
+        "*  With bin2c's \"-d\" option, the data refers back into a shared dictionary,\n",
+        "*  which the \"_dict\" variants of the functions take as a parameter.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_LZ_H__ )\n",
+        "\n",
+        "#define __BIN2C_LZ_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_LZ_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_LZ_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_LZ_API  static\n",
+        "#endif\n",
+        "\n",
+        "#define BIN2C_LZ_ERROR  ( ( size_t ) -1 )\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_length function\n",
+        "*\n",
+        "*  Reads a length that continues in extra bytes (i.e.: a nibble of 15 followed\n",
+        "*  by bytes that add up until one is less than 255).  Returns zero when the\n",
+        "*  data ends prematurely.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API int bin2c_lz_length ( unsigned char const * * src, unsigned char const * srcend, size_t * length )\n",
+        "{\n",
+        "    unsigned int extra;\n",
+        "\n",
+        "    do\n",
+        "    {\n",
+        "        if ( *src >= srcend )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "\n",
+        "        extra =   **src;\n",
+        "        *src +=   1;\n",
+        "        *length += extra;\n",
+        "    }\n",
+        "    while ( extra == 255u );\n",
+        "\n",
+        "    return ( 1 );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_decode_dict function\n",
+        "*\n",
+        "*  Decodes all of \"src\" into \"dst\", where matches may refer back past the start\n",
+        "*  of \"dst\" into the end of the dictionary \"dict\" (which may be \"NULL\" when\n",
+        "*  \"dictsize\" is zero).  Returns the number of decoded bytes, or\n",
+        "*  \"BIN2C_LZ_ERROR\" when the data is malformed or \"dst\" is too small.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_decode_dict ( unsigned char const * src, size_t srcsize, unsigned char const * dict, size_t dictsize, unsigned char * dst, size_t dstsize )\n",
+        "{\n",
+        "    unsigned char const * srcend;\n",
+        "    unsigned char *       dstbegin;\n",
+        "    unsigned char *       dstend;\n",
+        "\n",
+        "    srcend =   src + srcsize;\n",
+        "    dstbegin = dst;\n",
+        "    dstend =   dst + dstsize;\n",
+        "\n",
+        "    while ( src < srcend )\n",
+        "    {\n",
+        "        unsigned int          token;\n",
+        "        size_t                count;\n",
+        "        size_t                offset;\n",
+        "        unsigned char const * match;\n",
+        "\n",
+        "        token = *src;\n",
+        "        src +=  1;\n",
+        "        count = token >> 4;\n",
+        "\n",
+        "        if ( ( count == 15u ) && !bin2c_lz_length ( &src, srcend, &count ) )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        if ( ( ( size_t ) ( srcend - src ) < count ) || ( ( size_t ) ( dstend - dst ) < count ) )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        memcpy ( dst, src, count );\n",
+        "        dst += count;\n",
+        "        src += count;\n",
+        "\n",
+        "        if ( src >= srcend )\n",
+        "        {\n",
+        "            break;\n",
+        "        }\n",
+        "\n",
+        "        if ( ( srcend - src ) < 2 )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        offset = ( size_t ) src[0] | ( ( size_t ) src[1] << 8 );\n",
+        "        src +=   2;\n",
+        "        count =  ( token & 15u ) + 4u;\n",
+        "\n",
+        "        if ( ( ( token & 15u ) == 15u ) && !bin2c_lz_length ( &src, srcend, &count ) )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        if ( ( offset == 0 ) || ( offset > ( ( size_t ) ( dst - dstbegin ) + dictsize ) ) || ( ( size_t ) ( dstend - dst ) < count ) )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        /*\n",
+        "        ** The part of a match that precedes \"dst\" comes from the dictionary,\n",
+        "        *  and the rest of it from the start of \"dst\".\n",
+        "        */\n",
+        "\n",
+        "        if ( offset > ( size_t ) ( dst - dstbegin ) )\n",
+        "        {\n",
+        "            size_t back;\n",
+        "\n",
+        "            back =  offset - ( size_t ) ( dst - dstbegin );\n",
+        "            match = dict + ( dictsize - back );\n",
+        "\n",
+        "            while ( ( back > 0 ) && ( count > 0 ) )\n",
+        "            {\n",
+        "                *dst =   *match;\n",
+        "                dst +=   1;\n",
+        "                match += 1;\n",
+        "                back -=  1;\n",
+        "                count -= 1;\n",
+        "            }\n",
+        "\n",
+        "            match = dstbegin;\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            match = dst - offset;\n",
+        "        }\n",
+        "\n",
+        "        /*\n",
+        "        ** A match at a distance of one is a run of a single byte (a\n",
+        "        *  run-length record), and a match that does not overlap its own\n",
+        "        *  output is a plain copy.\n",
+        "        */\n",
+        "\n",
+        "        if ( ( count > 0 ) && ( match == dst - 1 ) )\n",
+        "        {\n",
+        "            memset ( dst, *match, count );\n",
+        "            dst += count;\n",
+        "        }\n",
+        "        else if ( ( size_t ) ( dst - match ) >= count )\n",
+        "        {\n",
+        "            memcpy ( dst, match, count );\n",
+        "            dst += count;\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            while ( count > 0 )\n",
+        "            {\n",
+        "                *dst =   *match;\n",
+        "                dst +=   1;\n",
+        "                match += 1;\n",
+        "                count -= 1;\n",
+        "            }\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( ( size_t ) ( dst - dstbegin ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_decode function\n",
+        "*\n",
+        "*  Decodes all of \"src\" into \"dst\".  Returns the number of decoded bytes, or\n",
+        "*  \"BIN2C_LZ_ERROR\" when the data is malformed or \"dst\" is too small.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_decode ( unsigned char const * src, size_t srcsize, unsigned char * dst, size_t dstsize )\n",
+        "{\n",
+        "    return ( bin2c_lz_decode_dict ( src, srcsize, NULL, 0, dst, dstsize ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_stream type\n",
+        "*\n",
+        "*  The state of a streaming decode, which produces the decoded data in pieces\n",
+        "*  of any size while keeping only a caller-provided window of the most recent\n",
+        "*  decoded bytes.  The window must be a power of two in size and at least as\n",
+        "*  large as the window that bin2c compressed the data with (its \"-w\" option).\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * src;\n",
+        "    unsigned char const * srcend;\n",
+        "    unsigned char *       window;\n",
+        "    size_t                mask;\n",
+        "    size_t                position;\n",
+        "    size_t                literals;\n",
+        "    size_t                matches;\n",
+        "    size_t                offset;\n",
+        "    unsigned int          token;\n",
+        "    int                   stage;\n",
+        "} bin2c_lz_stream;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_begin function\n",
+        "*\n",
+        "*  Prepares \"stream\" to decode \"src\" through \"window\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API void bin2c_lz_begin ( bin2c_lz_stream * stream, unsigned char const * src, size_t srcsize, unsigned char * window, size_t windowsize )\n",
+        "{\n",
+        "    stream->src =      src;\n",
+        "    stream->srcend =   src + srcsize;\n",
+        "    stream->window =   window;\n",
+        "    stream->mask =     windowsize - 1u;\n",
+        "    stream->position = 0;\n",
+        "    stream->literals = 0;\n",
+        "    stream->matches =  0;\n",
+        "    stream->offset =   0;\n",
+        "    stream->token =    0;\n",
+        "    stream->stage =    ( ( windowsize > 0 ) && ( ( windowsize & stream->mask ) == 0 ) ) ? 0 : -1;\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_begin_dict function\n",
+        "*\n",
+        "*  Prepares \"stream\" to decode \"src\" through \"window\", as if the end of the\n",
+        "*  dictionary \"dict\" (as much of it as fits in the window) were decoded first.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API void bin2c_lz_begin_dict ( bin2c_lz_stream * stream, unsigned char const * src, size_t srcsize, unsigned char const * dict, size_t dictsize, unsigned char * window, size_t windowsize )\n",
+        "{\n",
+        "    size_t count;\n",
+        "\n",
+        "    bin2c_lz_begin ( stream, src, srcsize, window, windowsize );\n",
+        "\n",
+        "    count = ( dictsize < windowsize ) ? dictsize : windowsize;\n",
+        "\n",
+        "    if ( stream->stage == 0 )\n",
+        "    {\n",
+        "        memcpy ( window, dict + ( dictsize - count ), count );\n",
+        "        stream->position = count;\n",
+        "    }\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_read function\n",
+        "*\n",
+        "*  Decodes up to \"dstsize\" bytes into \"dst\".  Returns the number of decoded\n",
+        "*  bytes, which is less than \"dstsize\" only at the end of the data, or\n",
+        "*  \"BIN2C_LZ_ERROR\" when the data is malformed or the window is too small.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_read ( bin2c_lz_stream * stream, unsigned char * dst, size_t dstsize )\n",
+        "{\n",
+        "    size_t produced;\n",
+        "\n",
+        "    produced = 0;\n",
+        "\n",
+        "    while ( produced < dstsize )\n",
+        "    {\n",
+        "        unsigned char value;\n",
+        "\n",
+        "        if ( stream->stage < 0 )\n",
+        "        {\n",
+        "            return ( BIN2C_LZ_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        if ( stream->literals > 0 )\n",
+        "        {\n",
+        "            value =             *stream->src;\n",
+        "            stream->src +=      1;\n",
+        "            stream->literals -= 1;\n",
+        "        }\n",
+        "        else if ( stream->matches > 0 )\n",
+        "        {\n",
+        "            value =            stream->window[( stream->position - stream->offset ) & stream->mask];\n",
+        "            stream->matches -= 1;\n",
+        "        }\n",
+        "        else if ( stream->stage == 0 )\n",
+        "        {\n",
+        "            if ( stream->src >= stream->srcend )\n",
+        "            {\n",
+        "                break;\n",
+        "            }\n",
+        "\n",
+        "            stream->token =    *stream->src;\n",
+        "            stream->src +=     1;\n",
+        "            stream->literals = stream->token >> 4;\n",
+        "            stream->stage =    1;\n",
+        "\n",
+        "            if ( ( ( stream->token >> 4 ) == 15u ) && !bin2c_lz_length ( &stream->src, stream->srcend, &stream->literals ) )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "            else if ( ( size_t ) ( stream->srcend - stream->src ) < stream->literals )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "\n",
+        "            continue;\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            if ( stream->src >= stream->srcend )\n",
+        "            {\n",
+        "                break;\n",
+        "            }\n",
+        "\n",
+        "            stream->offset =  0;\n",
+        "            stream->matches = ( stream->token & 15u ) + 4u;\n",
+        "            stream->stage =   0;\n",
+        "\n",
+        "            if ( ( stream->srcend - stream->src ) >= 2 )\n",
+        "            {\n",
+        "                stream->offset = ( size_t ) stream->src[0] | ( ( size_t ) stream->src[1] << 8 );\n",
+        "                stream->src +=   2;\n",
+        "            }\n",
+        "\n",
+        "            if ( ( ( stream->token & 15u ) == 15u ) && !bin2c_lz_length ( &stream->src, stream->srcend, &stream->matches ) )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "            else if ( ( stream->offset == 0 ) || ( stream->offset > stream->position ) || ( stream->offset > ( stream->mask + 1u ) ) )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "\n",
+        "            continue;\n",
+        "        }\n",
+        "\n",
+        "        stream->window[stream->position & stream->mask] = value;\n",
+        "        stream->position += 1;\n",
+        "\n",
+        "        dst[produced] = value;\n",
+        "        produced +=     1;\n",
+        "    }\n",
+        "\n",
+        "    return ( produced );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_blob type\n",
+        "*\n",
+        "*  The description of data that bin2c's \"-k\" option cut into independently\n",
+        "*  compressed blocks, which bin2c defines next to the array.  The block index\n",
+        "*  holds the offset of every block in the array and, last, the array's length.\n",
+        "*  Every block decodes to \"blocksize\" bytes, except that the last block may be\n",
+        "*  shorter.  With bin2c's \"-d\" option, every block refers back into the same\n",
+        "*  dictionary; otherwise, \"dictionary\" is \"NULL\".\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * data;\n",
+        "    unsigned long const * blocks;\n",
+        "    unsigned long         count;\n",
+        "    unsigned long         blocksize;\n",
+        "    unsigned long         decoded;\n",
+        "    unsigned char const * dictionary;\n",
+        "    unsigned long         dictsize;\n",
+        "} bin2c_lz_blob;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_block function\n",
+        "*\n",
+        "*  Decodes block \"index\" of \"blob\" into \"dst\", which must have room for\n",
+        "*  \"blocksize\" bytes.  Returns the number of decoded bytes, or\n",
+        "*  \"BIN2C_LZ_ERROR\" when the data is malformed or there is no such block.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_block ( bin2c_lz_blob const * blob, size_t index, unsigned char * dst )\n",
+        "{\n",
+        "    size_t size;\n",
+        "\n",
+        "    if ( index >= blob->count )\n",
+        "    {\n",
+        "        return ( BIN2C_LZ_ERROR );\n",
+        "    }\n",
+        "\n",
+        "    size = blob->decoded - ( index * blob->blocksize );\n",
+        "\n",
+        "    if ( size > blob->blocksize )\n",
+        "    {\n",
+        "        size = blob->blocksize;\n",
+        "    }\n",
+        "\n",
+        "    if ( bin2c_lz_decode_dict ( blob->data + blob->blocks[index], blob->blocks[index + 1u] - blob->blocks[index], blob->dictionary, blob->dictsize, dst, size ) != size )\n",
+        "    {\n",
+        "        return ( BIN2C_LZ_ERROR );\n",
+        "    }\n",
+        "\n",
+        "    return ( size );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_range function\n",
+        "*\n",
+        "*  Decodes the \"size\" bytes at offset \"start\" of the decoded data of \"blob\"\n",
+        "*  into \"dst\", decoding only the blocks that hold them.  Whole blocks decode\n",
+        "*  straight into \"dst\", while blocks that the range only partially covers\n",
+        "*  decode into \"scratch\", which must have room for \"blocksize\" bytes (or may be\n",
+        "*  \"NULL\" when the range starts and ends at the edges of blocks).  Returns\n",
+        "*  \"size\", or \"BIN2C_LZ_ERROR\" when the range exceeds the data, the data is\n",
+        "*  malformed or \"scratch\" is missing.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_range ( bin2c_lz_blob const * blob, size_t start, size_t size, unsigned char * dst, unsigned char * scratch )\n",
+        "{\n",
+        "    size_t done;\n",
+        "\n",
+        "    if ( ( start > blob->decoded ) || ( size > ( blob->decoded - start ) ) )\n",
+        "    {\n",
+        "        return ( BIN2C_LZ_ERROR );\n",
+        "    }\n",
+        "\n",
+        "    done = 0;\n",
+        "\n",
+        "    while ( done < size )\n",
+        "    {\n",
+        "        size_t index;\n",
+        "        size_t skip;\n",
+        "        size_t length;\n",
+        "        size_t take;\n",
+        "\n",
+        "        index =  ( start + done ) / blob->blocksize;\n",
+        "        skip =   ( start + done ) % blob->blocksize;\n",
+        "        length = blob->decoded - ( index * blob->blocksize );\n",
+        "\n",
+        "        if ( length > blob->blocksize )\n",
+        "        {\n",
+        "            length = blob->blocksize;\n",
+        "        }\n",
+        "\n",
+        "        take = length - skip;\n",
+        "\n",
+        "        if ( take > ( size - done ) )\n",
+        "        {\n",
+        "            take = size - done;\n",
+        "        }\n",
+        "\n",
+        "        if ( take == length )\n",
+        "        {\n",
+        "            if ( bin2c_lz_block ( blob, index, dst + done ) != length )\n",
+        "            {\n",
+        "                return ( BIN2C_LZ_ERROR );\n",
+        "            }\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            if ( ( scratch == NULL ) || ( bin2c_lz_block ( blob, index, scratch ) != length ) )\n",
+        "            {\n",
+        "                return ( BIN2C_LZ_ERROR );\n",
+        "            }\n",
+        "\n",
+        "            memcpy ( dst + done, scratch + skip, take );\n",
+        "        }\n",
+        "\n",
+        "        done += take;\n",
+        "    }\n",
+        "\n",
+        "    return ( size );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "#if defined ( BIN2C_LZ_THREADS )\n",
+        "\n",
+        "#if defined ( _WIN32 )\n",
+        "#include <windows.h>\n",
+        "#else\n",
+        "#include <pthread.h>\n",
+        "#endif\n",
+        "\n",
+        "#define BIN2C_LZ_MAXTHREADS  64u\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_task type\n",
+        "*\n",
+        "*  The consecutive blocks that one thread of \"bin2c_lz_parallel\" decodes.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    bin2c_lz_blob const * blob;\n",
+        "    size_t                first;\n",
+        "    size_t                last;\n",
+        "    unsigned char *       dst;\n",
+        "    int                   failed;\n",
+        "} bin2c_lz_task;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_work function\n",
+        "*\n",
+        "*  Decodes the blocks of a task, each into its place in the task's \"dst\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API void bin2c_lz_work ( bin2c_lz_task * task )\n",
+        "{\n",
+        "    size_t index;\n",
+        "\n",
+        "    for ( index = task->first; index < task->last; index += 1u )\n",
+        "    {\n",
+        "        if ( bin2c_lz_block ( task->blob, index, task->dst + ( index * task->blob->blocksize ) ) == BIN2C_LZ_ERROR )\n",
+        "        {\n",
+        "            task->failed = 1;\n",
+        "        }\n",
+        "    }\n",
+        "}\n",
+        "\n",
+        "#if defined ( _WIN32 )\n",
+        "BIN2C_LZ_API DWORD WINAPI bin2c_lz_thread ( LPVOID task )\n",
+        "{\n",
+        "    bin2c_lz_work ( ( bin2c_lz_task * ) task );\n",
+        "    return ( 0 );\n",
+        "}\n",
+        "#else\n",
+        "BIN2C_LZ_API void * bin2c_lz_thread ( void * task )\n",
+        "{\n",
+        "    bin2c_lz_work ( ( bin2c_lz_task * ) task );\n",
+        "    return ( NULL );\n",
+        "}\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_lz_parallel function\n",
+        "*\n",
+        "*  Decodes all of \"blob\" into \"dst\", which must have room for \"decoded\" bytes,\n",
+        "*  with up to \"threads\" threads (including the calling thread, and at most\n",
+        "*  \"BIN2C_LZ_MAXTHREADS\") that each decode a run of consecutive blocks.  A\n",
+        "*  thread that fails to start leaves its blocks to the calling thread.  Returns\n",
+        "*  the number of decoded bytes, or \"BIN2C_LZ_ERROR\" when the data is malformed.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_LZ_API size_t bin2c_lz_parallel ( bin2c_lz_blob const * blob, unsigned char * dst, unsigned int threads )\n",
+        "{\n",
+        "    bin2c_lz_task tasks[BIN2C_LZ_MAXTHREADS];\n",
+        "    #if defined ( _WIN32 )\n",
+        "    HANDLE        handles[BIN2C_LZ_MAXTHREADS];\n",
+        "    #else\n",
+        "    pthread_t     handles[BIN2C_LZ_MAXTHREADS];\n",
+        "    #endif\n",
+        "    int           started[BIN2C_LZ_MAXTHREADS];\n",
+        "    unsigned int  thread;\n",
+        "    int           failed;\n",
+        "\n",
+        "    if ( threads > BIN2C_LZ_MAXTHREADS )\n",
+        "    {\n",
+        "        threads = BIN2C_LZ_MAXTHREADS;\n",
+        "    }\n",
+        "\n",
+        "    if ( threads > blob->count )\n",
+        "    {\n",
+        "        threads = ( unsigned int ) blob->count;\n",
+        "    }\n",
+        "\n",
+        "    if ( threads < 1u )\n",
+        "    {\n",
+        "        threads = 1u;\n",
+        "    }\n",
+        "\n",
+        "    for ( thread = 0; thread < threads; thread += 1u )\n",
+        "    {\n",
+        "        tasks[thread].blob =   blob;\n",
+        "        tasks[thread].first =  ( ( blob->count / threads ) * thread ) + ( ( ( blob->count % threads ) * thread ) / threads );\n",
+        "        tasks[thread].last =   ( ( blob->count / threads ) * ( thread + 1u ) ) + ( ( ( blob->count % threads ) * ( thread + 1u ) ) / threads );\n",
+        "        tasks[thread].dst =    dst;\n",
+        "        tasks[thread].failed = 0;\n",
+        "    }\n",
+        "\n",
+        "    for ( thread = 1u; thread < threads; thread += 1u )\n",
+        "    {\n",
+        "        #if defined ( _WIN32 )\n",
+        "        handles[thread] = CreateThread ( NULL, 0, bin2c_lz_thread, &tasks[thread], 0, NULL );\n",
+        "        started[thread] = handles[thread] != NULL;\n",
+        "        #else\n",
+        "        started[thread] = pthread_create ( &handles[thread], NULL, bin2c_lz_thread, &tasks[thread] ) == 0;\n",
+        "        #endif\n",
+        "    }\n",
+        "\n",
+        "    bin2c_lz_work ( &tasks[0] );\n",
+        "    failed = tasks[0].failed;\n",
+        "\n",
+        "    for ( thread = 1u; thread < threads; thread += 1u )\n",
+        "    {\n",
+        "        if ( started[thread] )\n",
+        "        {\n",
+        "            #if defined ( _WIN32 )\n",
+        "            WaitForSingleObject ( handles[thread], INFINITE );\n",
+        "            CloseHandle ( handles[thread] );\n",
+        "            #else\n",
+        "            pthread_join ( handles[thread], NULL );\n",
+        "            #endif\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            bin2c_lz_work ( &tasks[thread] );\n",
+        "        }\n",
+        "\n",
+        "        failed |= tasks[thread].failed;\n",
+        "    }\n",
+        "\n",
+        "    return ( failed ? BIN2C_LZ_ERROR : ( size_t ) blob->decoded );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_lz.h",
+                                  lines ) );
+}
 
-        if ( length >= ( 2u + 1u ) )
-        {
-            length =  USHRT_MAX - length;
-            outpath = ( char * ) malloc ( sizeof ( *outpath ) * ( length + 2u + 1u ) );
-        }
 
-    }
 
-    /*
-    ** This is a specialized string copy algorithm due to the need to ignore
-    *  the input pathname's extension, if any is present, and to copy ". " into
-    *  the output pathname instead.
-    */
+/*
+** main_runbin2c_outputpatcher function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_delta.h", that holds the functions that apply the deltas
+*  of the "-v" option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
 
-    if ( outpath != NULL )
+static bool main_runbin2c_outputpatcher
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
     {
+        "/*\n",
+        "** bin2c delta patcher\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-v\" option,\n",
+        "*  whose arrays hold the input files as deltas against a base file, which bin2c\n",
+        "*  outputs once as an array of its own.  A delta is a sequence of operations.\n",
+        "*  Each one starts with a number whose lowest bit selects the operation and\n",
+        "*  whose other bits are its length: either that many literal bytes follow, or\n",
+        "*  that many bytes come from the base, starting at a second number's distance\n",
+        "*  from where the previous copy ended (even numbers are forward distances, odd\n",
+        "*  numbers backward ones).  Numbers take seven bits per byte, least significant\n",
+        "*  first, with the top bit set on all bytes but the last.  The functions apply\n",
+        "*  a delta into caller-provided memory, whole or in pieces of any size, and\n",
+        "*  never allocate from the heap.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_DELTA_H__ )\n",
+        "\n",
+        "#define __BIN2C_DELTA_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_DELTA_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_DELTA_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_DELTA_API  static\n",
+        "#endif\n",
+        "\n",
+        "#define BIN2C_DELTA_ERROR  ( ( size_t ) -1 )\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_delta_number function\n",
+        "*\n",
+        "*  Reads a number.  Returns zero when the data ends prematurely or the number\n",
+        "*  does not fit in a \"size_t\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_DELTA_API int bin2c_delta_number ( unsigned char const * * src, unsigned char const * srcend, size_t * number )\n",
+        "{\n",
+        "    size_t       value;\n",
+        "    unsigned int shift;\n",
+        "\n",
+        "    value = 0;\n",
+        "    shift = 0;\n",
+        "\n",
+        "    while ( *src < srcend )\n",
+        "    {\n",
+        "        size_t bits;\n",
+        "\n",
+        "        bits =  ( size_t ) ( **src & 127u );\n",
+        "        *src += 1;\n",
+        "\n",
+        "        if ( ( shift >= ( sizeof ( value ) * 8u ) ) || ( ( ( bits << shift ) >> shift ) != bits ) )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "\n",
+        "        value |= bits << shift;\n",
+        "        shift += 7u;\n",
+        "\n",
+        "        if ( ( *src )[-1] < 128u )\n",
+        "        {\n",
+        "            *number = value;\n",
+        "            return ( 1 );\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( 0 );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_delta_stream type\n",
+        "*\n",
+        "*  The state of a streaming patch, which produces the input file's data in\n",
+        "*  pieces of any size from the delta and the base.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * src;\n",
+        "    unsigned char const * srcend;\n",
+        "    unsigned char const * base;\n",
+        "    size_t                basesize;\n",
+        "    size_t                position;\n",
+        "    size_t                literals;\n",
+        "    size_t                copies;\n",
+        "    int                   stage;\n",
+        "} bin2c_delta_stream;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_delta_begin function\n",
+        "*\n",
+        "*  Prepares \"stream\" to apply the delta \"src\" to \"base\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_DELTA_API void bin2c_delta_begin ( bin2c_delta_stream * stream, unsigned char const * src, size_t srcsize, unsigned char const * base, size_t basesize )\n",
+        "{\n",
+        "    stream->src =      src;\n",
+        "    stream->srcend =   src + srcsize;\n",
+        "    stream->base =     base;\n",
+        "    stream->basesize = basesize;\n",
+        "    stream->position = 0;\n",
+        "    stream->literals = 0;\n",
+        "    stream->copies =   0;\n",
+        "    stream->stage =    0;\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_delta_read function\n",
+        "*\n",
+        "*  Produces up to \"dstsize\" bytes into \"dst\".  Returns the number of bytes\n",
+        "*  produced, which is less than \"dstsize\" only at the end of the data, or\n",
+        "*  \"BIN2C_DELTA_ERROR\" when the delta is malformed or does not fit the base.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_DELTA_API size_t bin2c_delta_read ( bin2c_delta_stream * stream, unsigned char * dst, size_t dstsize )\n",
+        "{\n",
+        "    size_t produced;\n",
+        "\n",
+        "    produced = 0;\n",
+        "\n",
+        "    while ( produced < dstsize )\n",
+        "    {\n",
+        "        size_t count;\n",
+        "        size_t number;\n",
+        "\n",
+        "        if ( stream->stage < 0 )\n",
+        "        {\n",
+        "            return ( BIN2C_DELTA_ERROR );\n",
+        "        }\n",
+        "\n",
+        "        count = dstsize - produced;\n",
+        "\n",
+        "        if ( stream->literals > 0 )\n",
+        "        {\n",
+        "            count = ( stream->literals < count ) ? stream->literals : count;\n",
+        "\n",
+        "            memcpy ( dst + produced, stream->src, count );\n",
+        "\n",
+        "            stream->src +=      count;\n",
+        "            stream->literals -= count;\n",
+        "            produced +=         count;\n",
+        "        }\n",
+        "        else if ( stream->copies > 0 )\n",
+        "        {\n",
+        "            count = ( stream->copies < count ) ? stream->copies : count;\n",
+        "\n",
+        "            memcpy ( dst + produced, stream->base + stream->position, count );\n",
+        "\n",
+        "            stream->position += count;\n",
+        "            stream->copies -=   count;\n",
+        "            produced +=         count;\n",
+        "        }\n",
+        "        else if ( stream->src >= stream->srcend )\n",
+        "        {\n",
+        "            break;\n",
+        "        }\n",
+        "        else if ( !bin2c_delta_number ( &stream->src, stream->srcend, &number ) )\n",
+        "        {\n",
+        "            stream->stage = -1;\n",
+        "        }\n",
+        "        else if ( ( number & 1u ) == 0 )\n",
+        "        {\n",
+        "            stream->literals = number >> 1;\n",
+        "\n",
+        "            if ( ( size_t ) ( stream->srcend - stream->src ) < stream->literals )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            size_t distance;\n",
+        "\n",
+        "            stream->copies = number >> 1;\n",
+        "\n",
+        "            if ( !bin2c_delta_number ( &stream->src, stream->srcend, &distance ) )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "            else if ( ( distance & 1u ) == 0 )\n",
+        "            {\n",
+        "                if ( ( distance >> 1 ) > ( stream->basesize - stream->position ) )\n",
+        "                {\n",
+        "                    stream->stage = -1;\n",
+        "                }\n",
+        "                else\n",
+        "                {\n",
+        "                    stream->position += distance >> 1;\n",
+        "                }\n",
+        "            }\n",
+        "            else\n",
+        "            {\n",
+        "                if ( ( distance >> 1 ) >= stream->position )\n",
+        "                {\n",
+        "                    stream->stage = -1;\n",
+        "                }\n",
+        "                else\n",
+        "                {\n",
+        "                    stream->position -= ( distance >> 1 ) + 1u;\n",
+        "                }\n",
+        "            }\n",
+        "\n",
+        "            if ( stream->copies > ( stream->basesize - stream->position ) )\n",
+        "            {\n",
+        "                stream->stage = -1;\n",
+        "            }\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( produced );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_delta_apply function\n",
+        "*\n",
+        "*  Applies the delta \"src\" to \"base\" into \"dst\", which must have room for the\n",
+        "*  whole input file (i.e.: the \"_decoded\" size).  Returns the number of bytes\n",
+        "*  produced, or \"BIN2C_DELTA_ERROR\" when the delta is malformed or \"dst\" is\n",
+        "*  too small.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_DELTA_API size_t bin2c_delta_apply ( unsigned char const * src, size_t srcsize, unsigned char const * base, size_t basesize, unsigned char * dst, size_t dstsize )\n",
+        "{\n",
+        "    bin2c_delta_stream stream;\n",
+        "    size_t             produced;\n",
+        "\n",
+        "    bin2c_delta_begin ( &stream, src, srcsize, base, basesize );\n",
+        "\n",
+        "    produced = bin2c_delta_read ( &stream, dst, dstsize );\n",
+        "\n",
+        "    if ( ( produced == dstsize ) && ( ( stream.literals > 0 ) || ( stream.copies > 0 ) || ( stream.src < stream.srcend ) ) )\n",
+        "    {\n",
+        "        return ( BIN2C_DELTA_ERROR );\n",
+        "    }\n",
+        "\n",
+        "    return ( produced );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_delta.h",
+                                  lines ) );
+}
 
-        offset = length;
 
-        while ( length > 0 )
+
+/*
+** main_runbin2c_outputreloader function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_reload.h", that holds the functions that read the input
+*  binary files of the "-r" option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runbin2c_outputreloader
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c reloading asset\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-r\" option,\n",
+        "*  whose header files, when the option's macro is defined, resolve the array's\n",
+        "*  name to the input file's current data instead of the data it had when bin2c\n",
+        "*  ran.  The functions read a copy of the input file into memory on first use\n",
+        "*  and read it again once it changes (i.e.: its modification time, to the\n",
+        "*  fraction of a second where the system records it, size or identity, which\n",
+        "*  an editor that saves by replacing the file changes).  They check for changes\n",
+        "*  at most once per second, so accessing the data in a loop costs little more\n",
+        "*  than a function call.  An edited input file then needs no new run of bin2c,\n",
+        "*  compilation or linking, but only a moment.\n",
+        "*\n",
+        "*  A copy is only published when the input file did not change while it was\n",
+        "*  read, so the data is always complete and never changes under a pointer, even\n",
+        "*  when the input file is overwritten in place or truncated.  A copy of an input\n",
+        "*  file modified in the second it was read is read again at the next check, in\n",
+        "*  case a save in that second kept the modification time.  The copy that a\n",
+        "*  change supersedes remains valid until the next change, after which it is\n",
+        "*  released, so at most two copies per input file are in memory: a pointer must\n",
+        "*  not be kept across more than one change (at least a second).  This is a\n",
+        "*  development aid, not for production.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_RELOAD_H__ )\n",
+        "\n",
+        "#define __BIN2C_RELOAD_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <stdio.h>\n",
+        "#include <stdlib.h>\n",
+        "#include <time.h>\n",
+        "\n",
+        "#if defined ( _WIN32 )\n",
+        "#if !defined ( WIN32_LEAN_AND_MEAN )\n",
+        "#define WIN32_LEAN_AND_MEAN\n",
+        "#endif\n",
+        "#include <windows.h>\n",
+        "#define BIN2C_RELOAD_WINDOWS\n",
+        "#elif defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )\n",
+        "#include <sys/types.h>\n",
+        "#include <sys/stat.h>\n",
+        "#define BIN2C_RELOAD_POSIX\n",
+        "#endif\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_RELOAD_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_RELOAD_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_RELOAD_API  static\n",
+        "#endif\n",
+        "\n",
+        "/*\n",
+        "** The current copy is replaced with an atomic compare-and-swap, and the time\n",
+        "*  of the last check is an atomic number, where the compiler has them.\n",
+        "*  (Elsewhere, only one thread may use an asset.)\n",
+        "*/\n",
+        "\n",
+        "#if defined ( _MSC_VER )\n",
+        "#define BIN2C_RELOAD_LOAD( current )                    InterlockedCompareExchangePointer ( ( void * volatile * ) ( current ), NULL, NULL )\n",
+        "#define BIN2C_RELOAD_PUBLISH( current, expected, fresh )  InterlockedCompareExchangePointer ( ( void * volatile * ) ( current ), ( fresh ), ( expected ) )\n",
+        "#define BIN2C_RELOAD_LOADTIME( checked )                InterlockedCompareExchange ( ( checked ), 0, 0 )\n",
+        "#define BIN2C_RELOAD_STORETIME( checked, now )          InterlockedExchange ( ( checked ), ( now ) )\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_RELOAD_LOAD( current )                    __atomic_load_n ( ( current ), __ATOMIC_ACQUIRE )\n",
+        "#define BIN2C_RELOAD_PUBLISH( current, expected, fresh )  __sync_val_compare_and_swap ( ( current ), ( expected ), ( fresh ) )\n",
+        "#define BIN2C_RELOAD_LOADTIME( checked )                __atomic_load_n ( ( checked ), __ATOMIC_RELAXED )\n",
+        "#define BIN2C_RELOAD_STORETIME( checked, now )          __atomic_store_n ( ( checked ), ( now ), __ATOMIC_RELAXED )\n",
+        "#else\n",
+        "#define BIN2C_RELOAD_LOAD( current )                    ( *( current ) )\n",
+        "#define BIN2C_RELOAD_PUBLISH( current, expected, fresh )  ( ( *( current ) == ( expected ) ) ? ( *( current ) = ( fresh ), ( expected ) ) : *( current ) )\n",
+        "#define BIN2C_RELOAD_LOADTIME( checked )                ( *( checked ) )\n",
+        "#define BIN2C_RELOAD_STORETIME( checked, now )          ( *( checked ) = ( now ) )\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_span type\n",
+        "*\n",
+        "*  An input file's data: where its copy is and its number of bytes, or \"NULL\"\n",
+        "*  and zero when the input file has not been available yet.  The header files\n",
+        "*  of the \"-r\" option define it as well (for their other alternative).\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( BIN2C_RELOAD_SPAN )\n",
+        "\n",
+        "#define BIN2C_RELOAD_SPAN\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * data;\n",
+        "    size_t                size;\n",
+        "} bin2c_reload_span;\n",
+        "\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_copy type\n",
+        "*\n",
+        "*  A copy of an input file, with the copy that it superseded (which it releases\n",
+        "*  in turn), what identifies the version of the input file that it holds and\n",
+        "*  whether that version is settled (i.e.: it was modified before the second in\n",
+        "*  which it was read).  The data follows the structure, in the same allocation.\n",
+        "*/\n",
+        "\n",
+        "typedef struct bin2c_reload_copy\n",
+        "{\n",
+        "    bin2c_reload_span          span;\n",
+        "    struct bin2c_reload_copy * previous;\n",
+        "    unsigned long              stamp[4];\n",
+        "    int                        settled;\n",
+        "} bin2c_reload_copy;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_asset type\n",
+        "*\n",
+        "*  An input file: its pathname, its current copy (\"NULL\" until it is first\n",
+        "*  read) and the time of the last check for changes.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    char const *        path;\n",
+        "    bin2c_reload_copy * current;\n",
+        "    long                checked;\n",
+        "} bin2c_reload_asset;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_identify function\n",
+        "*\n",
+        "*  Stores the size of the input file at \"path\" into \"size\" and what identifies\n",
+        "*  its version into \"stamp\": the seconds since 1970 and the fraction of a second\n",
+        "*  (in the system's unit) of its modification time, and its identity.  Returns\n",
+        "*  zero when the input file is not available.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_RELOAD_API int bin2c_reload_identify ( char const * path, size_t * size, unsigned long * stamp )\n",
+        "{\n",
+        "#if defined ( BIN2C_RELOAD_WINDOWS )\n",
+        "    WIN32_FILE_ATTRIBUTE_DATA status;\n",
+        "    ULARGE_INTEGER            modified;\n",
+        "\n",
+        "    if ( !GetFileAttributesExA ( path, GetFileExInfoStandard, &status ) || ( status.nFileSizeHigh != 0 ) )\n",
+        "    {\n",
+        "        return ( 0 );\n",
+        "    }\n",
+        "\n",
+        "    modified.LowPart =  status.ftLastWriteTime.dwLowDateTime;\n",
+        "    modified.HighPart = status.ftLastWriteTime.dwHighDateTime;\n",
+        "\n",
+        "    *size =    ( size_t ) status.nFileSizeLow;\n",
+        "    stamp[0] = ( unsigned long ) ( ( modified.QuadPart / 10000000u ) - 11644473600u );\n",
+        "    stamp[1] = ( unsigned long ) ( modified.QuadPart % 10000000u );\n",
+        "    stamp[2] = ( unsigned long ) status.ftCreationTime.dwLowDateTime;\n",
+        "    stamp[3] = ( unsigned long ) status.ftCreationTime.dwHighDateTime;\n",
+        "\n",
+        "    return ( 1 );\n",
+        "#elif defined ( BIN2C_RELOAD_POSIX )\n",
+        "    struct stat status;\n",
+        "\n",
+        "    if ( stat ( path, &status ) != 0 )\n",
+        "    {\n",
+        "        return ( 0 );\n",
+        "    }\n",
+        "\n",
+        "    /*\n",
+        "    ** Where \"<sys/stat.h>\" has the \"timespec\" of the modification time, it\n",
+        "    *  defines \"st_mtime\" as a macro for its seconds.\n",
+        "    */\n",
+        "\n",
+        "    *size =    ( size_t ) status.st_size;\n",
+        "    stamp[0] = ( unsigned long ) status.st_mtime;\n",
+        "#if defined ( __APPLE__ ) && defined ( st_mtime )\n",
+        "    stamp[1] = ( unsigned long ) status.st_mtimespec.tv_nsec;\n",
+        "#elif defined ( st_mtime )\n",
+        "    stamp[1] = ( unsigned long ) status.st_mtim.tv_nsec;\n",
+        "#else\n",
+        "    stamp[1] = 0;\n",
+        "#endif\n",
+        "    stamp[2] = ( unsigned long ) status.st_ino;\n",
+        "    stamp[3] = ( unsigned long ) status.st_dev;\n",
+        "\n",
+        "    return ( 1 );\n",
+        "#else\n",
+        "    ( void ) path;\n",
+        "    ( void ) size;\n",
+        "    ( void ) stamp;\n",
+        "\n",
+        "    return ( 0 );\n",
+        "#endif\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_same function\n",
+        "*\n",
+        "*  Returns non-zero when \"copy\" holds the version of the input file that \"size\"\n",
+        "*  and \"stamp\" identify.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_RELOAD_API int bin2c_reload_same ( bin2c_reload_copy const * copy, size_t size, unsigned long const * stamp )\n",
+        "{\n",
+        "    return ( ( copy->span.size == size ) && ( copy->stamp[0] == stamp[0] ) && ( copy->stamp[1] == stamp[1] ) && ( copy->stamp[2] == stamp[2] ) && ( copy->stamp[3] == stamp[3] ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_read function\n",
+        "*\n",
+        "*  Reads a copy of the input file at \"path\" into memory.  Returns the copy, or\n",
+        "*  \"NULL\" when the input file is not available or changed while it was read\n",
+        "*  (e.g.: while an editor overwrites it in place).\n",
+        "*/\n",
+        "\n",
+        "BIN2C_RELOAD_API bin2c_reload_copy * bin2c_reload_read ( char const * path )\n",
+        "{\n",
+        "    bin2c_reload_copy * copy;\n",
+        "    unsigned long       stamp[4];\n",
+        "    unsigned long       started;\n",
+        "    size_t              size;\n",
+        "    FILE *              file;\n",
+        "    int                 complete;\n",
+        "\n",
+        "    started = ( unsigned long ) time ( NULL );\n",
+        "\n",
+        "    if ( !bin2c_reload_identify ( path, &size, stamp ) || ( size > ( ( size_t ) -1 ) - sizeof ( *copy ) ) )\n",
+        "    {\n",
+        "        return ( NULL );\n",
+        "    }\n",
+        "\n",
+        "    copy = ( bin2c_reload_copy * ) malloc ( sizeof ( *copy ) + size );\n",
+        "    file = ( copy != NULL ) ? fopen ( path, \"rb\" ) : NULL;\n",
+        "\n",
+        "    if ( file == NULL )\n",
+        "    {\n",
+        "        free ( copy );\n",
+        "\n",
+        "        return ( NULL );\n",
+        "    }\n",
+        "\n",
+        "    copy->span.data = ( unsigned char const * ) ( copy + 1 );\n",
+        "    copy->span.size = size;\n",
+        "    copy->previous =  NULL;\n",
+        "\n",
+        "    complete = ( fread ( copy + 1, 1, size, file ) == size ) && ( fgetc ( file ) == EOF );\n",
+        "\n",
+        "    fclose ( file );\n",
+        "\n",
+        "    if ( !complete || !bin2c_reload_identify ( path, &size, copy->stamp ) || !bin2c_reload_same ( copy, size, stamp ) )\n",
+        "    {\n",
+        "        free ( copy );\n",
+        "\n",
+        "        return ( NULL );\n",
+        "    }\n",
+        "\n",
+        "    copy->settled = stamp[0] < started;\n",
+        "\n",
+        "    return ( copy );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_reload_get function\n",
+        "*\n",
+        "*  Returns the current data of \"asset\", which is read again when the input file\n",
+        "*  changed since the last check (at least a second ago), or when the copy is\n",
+        "*  not settled.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_RELOAD_API bin2c_reload_span bin2c_reload_get ( bin2c_reload_asset * asset )\n",
+        "{\n",
+        "    static bin2c_reload_span const none = { NULL, 0 };\n",
+        "\n",
+        "    bin2c_reload_copy * current;\n",
+        "    long                now;\n",
+        "\n",
+        "    current = ( bin2c_reload_copy * ) BIN2C_RELOAD_LOAD ( &asset->current );\n",
+        "    now =     ( long ) time ( NULL );\n",
+        "\n",
+        "    if ( BIN2C_RELOAD_LOADTIME ( &asset->checked ) != now )\n",
+        "    {\n",
+        "        unsigned long stamp[4];\n",
+        "        size_t        size;\n",
+        "\n",
+        "        BIN2C_RELOAD_STORETIME ( &asset->checked, now );\n",
+        "\n",
+        "        if ( bin2c_reload_identify ( asset->path, &size, stamp ) &&\n",
+        "             ( ( current == NULL ) || !current->settled || !bin2c_reload_same ( current, size, stamp ) ) )\n",
+        "        {\n",
+        "            bin2c_reload_copy * fresh;\n",
+        "\n",
+        "            fresh = bin2c_reload_read ( asset->path );\n",
+        "\n",
+        "            if ( fresh != NULL )\n",
+        "            {\n",
+        "                bin2c_reload_copy * previous;\n",
+        "\n",
+        "                fresh->previous = current;\n",
+        "                previous =        ( bin2c_reload_copy * ) BIN2C_RELOAD_PUBLISH ( &asset->current, current, fresh );\n",
+        "\n",
+        "                if ( previous != current )\n",
+        "                {\n",
+        "                    free ( fresh );\n",
+        "\n",
+        "                    fresh = previous;\n",
+        "                }\n",
+        "                else if ( ( current != NULL ) && ( current->previous != NULL ) )\n",
+        "                {\n",
+        "                    free ( current->previous );\n",
+        "\n",
+        "                    current->previous = NULL;\n",
+        "                }\n",
+        "\n",
+        "                current = fresh;\n",
+        "            }\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( ( current != NULL ) ? current->span : none );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_reload.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runbin2c_outputreload function
+*
+*  This function outputs the alternative to the array of the "-r" option's
+*  header file, which resolves the array's name to the input binary file's
+*  current data, and the conditional that chooses between the two.
+*
+*  Parameter(s)
+*
+*  symbol:     pointer to the name of the array (usually the name of the input
+*              binary file, without the leading file path and without the
+*              trailing file extension)
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the alternative, up to the "#else"
+*            directive that precedes the array
+*
+*  Remarks
+*
+*  The asset, named with the "_reload" suffix, has static scope like the array,
+*  so every source file that accesses the data reads the input binary file on
+*  its own.  The array's name and the "_size" macro both fetch the current data
+*  (which a change can replace between the two), so the "_span" macro fetches
+*  both at once, as a "bin2c_reload_span", which the other alternative defines
+*  as a constant.  The header file defines that type too, so that the other
+*  alternative does not include "bin2c_reload.h".  The array's initializer is in
+*  the other alternative, so the compiler skips it instead of parsing it.
+*/
+
+static bool main_runbin2c_outputreload
+(
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    static char const * const suffixes[3] = { NULL, "_size", "_span" };
+    static char const * const members[3] =  { " ).data )\n", " ).size )\n", " ) )\n\n#else\n\n" };
+
+    bool success;
+    int  error;
+    int  name;
+
+    error =   fprintf ( outfile,
+                        "#include <stddef.h>\n\n"
+                        "#if !defined ( BIN2C_RELOAD_SPAN )\n\n#define BIN2C_RELOAD_SPAN\n\n"
+                        "typedef struct\n{\n    unsigned char const * data;\n    size_t                size;\n} bin2c_reload_span;\n\n#endif\n\n"
+                        "#if defined ( %s )\n\n#include \"bin2c_reload.h\"\n\n#if defined ( __GNUC__ )\n__attribute__ ( ( unused ) )\n#endif\nstatic bin2c_reload_asset ",
+                        arguments->reload );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            symbol,
+                                            "_reload",
+                                            outfile );
+
+    error =    fputs ( " = { \"",
+                       outfile );
+    success &= error >= 0;
+
+    success &= main_outputliteral ( arguments->origin,
+                                    outfile );
+
+    error =    fputs ( "\", NULL, 0 };\n\n",
+                       outfile );
+    success &= error >= 0;
+
+    for ( name = 0; success && ( name < 3 ); name += 1 )
+    {
+        error =   fputs ( "#define ",
+                          outfile );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                ( name == 0 ) ? arguments->suffix : suffixes[name],
+                                                outfile );
+
+        error =    fputs ( "  ( bin2c_reload_get ( &",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_reload",
+                                                outfile );
+
+        error =    fputs ( members[name],
+                           outfile );
+        success &= error >= 0;
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputhasher function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_crc.h", that holds the functions that verify the data
+*  against the checksums of the "-k" option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runbin2c_outputhasher
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c checksums\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-k\" option,\n",
+        "*  which hashes the input file's data with CRC32C (i.e.: the Castagnoli CRC of\n",
+        "*  iSCSI, ext4 and SSE 4.2's \"crc32\" instruction), both whole and in blocks of\n",
+        "*  the option's size, at generation time.  The whole data's checksum is a\n",
+        "*  constant, for use as a cache key (or a quick integrity check) without\n",
+        "*  rehashing the data at startup, and the blocks' checksums let a program\n",
+        "*  verify just the blocks that it touches, whether it reads the array directly\n",
+        "*  or decodes it (the checksums are of the decoded data).  The functions use\n",
+        "*  the processor's CRC32C instructions where the compiler targets them.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_CRC_H__ )\n",
+        "\n",
+        "#define __BIN2C_CRC_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "\n",
+        "#if defined ( __SSE4_2__ ) || defined ( __AVX__ )\n",
+        "#include <nmmintrin.h>\n",
+        "#define BIN2C_CRC_SSE42\n",
+        "#elif defined ( __ARM_FEATURE_CRC32 )\n",
+        "#include <arm_acle.h>\n",
+        "#define BIN2C_CRC_ARM\n",
+        "#endif\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_CRC_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_CRC_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_CRC_API  static\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_crc_index type\n",
+        "*\n",
+        "*  The checksums of an input file's data: the checksum of every block, their\n",
+        "*  number, the number of bytes per block (the last block may be shorter), the\n",
+        "*  number of bytes of the data and the checksum of the whole data.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned long const * hashes;\n",
+        "    size_t                count;\n",
+        "    size_t                blocksize;\n",
+        "    size_t                size;\n",
+        "    unsigned long         crc32c;\n",
+        "} bin2c_crc_index;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_crc_update function\n",
+        "*\n",
+        "*  Returns the CRC32C register \"crc\" updated with the \"size\" bytes at \"data\".\n",
+        "*  (The register starts as \"0xFFFFFFFF\" and the checksum is its complement.)\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CRC_API unsigned long bin2c_crc_update ( unsigned long crc, unsigned char const * data, size_t size )\n",
+        "{\n",
+        "#if defined ( BIN2C_CRC_SSE42 )\n",
+        "    unsigned int value;\n",
+        "\n",
+        "    value = ( unsigned int ) crc;\n",
+        "\n",
+        "    while ( size >= 4u )\n",
+        "    {\n",
+        "        value = _mm_crc32_u32 ( value, ( unsigned int ) data[0] | ( ( unsigned int ) data[1] << 8 ) | ( ( unsigned int ) data[2] << 16 ) | ( ( unsigned int ) data[3] << 24 ) );\n",
+        "        data += 4u;\n",
+        "        size -= 4u;\n",
+        "    }\n",
+        "\n",
+        "    while ( size > 0 )\n",
+        "    {\n",
+        "        value = _mm_crc32_u8 ( value, *data );\n",
+        "        data += 1u;\n",
+        "        size -= 1u;\n",
+        "    }\n",
+        "\n",
+        "    return ( ( unsigned long ) value );\n",
+        "#elif defined ( BIN2C_CRC_ARM )\n",
+        "    unsigned int value;\n",
+        "\n",
+        "    value = ( unsigned int ) crc;\n",
+        "\n",
+        "    while ( size >= 4u )\n",
+        "    {\n",
+        "        value = __crc32cw ( value, ( unsigned int ) data[0] | ( ( unsigned int ) data[1] << 8 ) | ( ( unsigned int ) data[2] << 16 ) | ( ( unsigned int ) data[3] << 24 ) );\n",
+        "        data += 4u;\n",
+        "        size -= 4u;\n",
+        "    }\n",
+        "\n",
+        "    while ( size > 0 )\n",
+        "    {\n",
+        "        value = __crc32cb ( value, *data );\n",
+        "        data += 1u;\n",
+        "        size -= 1u;\n",
+        "    }\n",
+        "\n",
+        "    return ( ( unsigned long ) value );\n",
+        "#else\n",
+        "    static unsigned long const table[256] =\n",
+        "    {\n",
+        "        0x00000000ul, 0xF26B8303ul, 0xE13B70F7ul, 0x1350F3F4ul,\n",
+        "        0xC79A971Ful, 0x35F1141Cul, 0x26A1E7E8ul, 0xD4CA64EBul,\n",
+        "        0x8AD958CFul, 0x78B2DBCCul, 0x6BE22838ul, 0x9989AB3Bul,\n",
+        "        0x4D43CFD0ul, 0xBF284CD3ul, 0xAC78BF27ul, 0x5E133C24ul,\n",
+        "        0x105EC76Ful, 0xE235446Cul, 0xF165B798ul, 0x030E349Bul,\n",
+        "        0xD7C45070ul, 0x25AFD373ul, 0x36FF2087ul, 0xC494A384ul,\n",
+        "        0x9A879FA0ul, 0x68EC1CA3ul, 0x7BBCEF57ul, 0x89D76C54ul,\n",
+        "        0x5D1D08BFul, 0xAF768BBCul, 0xBC267848ul, 0x4E4DFB4Bul,\n",
+        "        0x20BD8EDEul, 0xD2D60DDDul, 0xC186FE29ul, 0x33ED7D2Aul,\n",
+        "        0xE72719C1ul, 0x154C9AC2ul, 0x061C6936ul, 0xF477EA35ul,\n",
+        "        0xAA64D611ul, 0x580F5512ul, 0x4B5FA6E6ul, 0xB93425E5ul,\n",
+        "        0x6DFE410Eul, 0x9F95C20Dul, 0x8CC531F9ul, 0x7EAEB2FAul,\n",
+        "        0x30E349B1ul, 0xC288CAB2ul, 0xD1D83946ul, 0x23B3BA45ul,\n",
+        "        0xF779DEAEul, 0x05125DADul, 0x1642AE59ul, 0xE4292D5Aul,\n",
+        "        0xBA3A117Eul, 0x4851927Dul, 0x5B016189ul, 0xA96AE28Aul,\n",
+        "        0x7DA08661ul, 0x8FCB0562ul, 0x9C9BF696ul, 0x6EF07595ul,\n",
+        "        0x417B1DBCul, 0xB3109EBFul, 0xA0406D4Bul, 0x522BEE48ul,\n",
+        "        0x86E18AA3ul, 0x748A09A0ul, 0x67DAFA54ul, 0x95B17957ul,\n",
+        "        0xCBA24573ul, 0x39C9C670ul, 0x2A993584ul, 0xD8F2B687ul,\n",
+        "        0x0C38D26Cul, 0xFE53516Ful, 0xED03A29Bul, 0x1F682198ul,\n",
+        "        0x5125DAD3ul, 0xA34E59D0ul, 0xB01EAA24ul, 0x42752927ul,\n",
+        "        0x96BF4DCCul, 0x64D4CECFul, 0x77843D3Bul, 0x85EFBE38ul,\n",
+        "        0xDBFC821Cul, 0x2997011Ful, 0x3AC7F2EBul, 0xC8AC71E8ul,\n",
+        "        0x1C661503ul, 0xEE0D9600ul, 0xFD5D65F4ul, 0x0F36E6F7ul,\n",
+        "        0x61C69362ul, 0x93AD1061ul, 0x80FDE395ul, 0x72966096ul,\n",
+        "        0xA65C047Dul, 0x5437877Eul, 0x4767748Aul, 0xB50CF789ul,\n",
+        "        0xEB1FCBADul, 0x197448AEul, 0x0A24BB5Aul, 0xF84F3859ul,\n",
+        "        0x2C855CB2ul, 0xDEEEDFB1ul, 0xCDBE2C45ul, 0x3FD5AF46ul,\n",
+        "        0x7198540Dul, 0x83F3D70Eul, 0x90A324FAul, 0x62C8A7F9ul,\n",
+        "        0xB602C312ul, 0x44694011ul, 0x5739B3E5ul, 0xA55230E6ul,\n",
+        "        0xFB410CC2ul, 0x092A8FC1ul, 0x1A7A7C35ul, 0xE811FF36ul,\n",
+        "        0x3CDB9BDDul, 0xCEB018DEul, 0xDDE0EB2Aul, 0x2F8B6829ul,\n",
+        "        0x82F63B78ul, 0x709DB87Bul, 0x63CD4B8Ful, 0x91A6C88Cul,\n",
+        "        0x456CAC67ul, 0xB7072F64ul, 0xA457DC90ul, 0x563C5F93ul,\n",
+        "        0x082F63B7ul, 0xFA44E0B4ul, 0xE9141340ul, 0x1B7F9043ul,\n",
+        "        0xCFB5F4A8ul, 0x3DDE77ABul, 0x2E8E845Ful, 0xDCE5075Cul,\n",
+        "        0x92A8FC17ul, 0x60C37F14ul, 0x73938CE0ul, 0x81F80FE3ul,\n",
+        "        0x55326B08ul, 0xA759E80Bul, 0xB4091BFFul, 0x466298FCul,\n",
+        "        0x1871A4D8ul, 0xEA1A27DBul, 0xF94AD42Ful, 0x0B21572Cul,\n",
+        "        0xDFEB33C7ul, 0x2D80B0C4ul, 0x3ED04330ul, 0xCCBBC033ul,\n",
+        "        0xA24BB5A6ul, 0x502036A5ul, 0x4370C551ul, 0xB11B4652ul,\n",
+        "        0x65D122B9ul, 0x97BAA1BAul, 0x84EA524Eul, 0x7681D14Dul,\n",
+        "        0x2892ED69ul, 0xDAF96E6Aul, 0xC9A99D9Eul, 0x3BC21E9Dul,\n",
+        "        0xEF087A76ul, 0x1D63F975ul, 0x0E330A81ul, 0xFC588982ul,\n",
+        "        0xB21572C9ul, 0x407EF1CAul, 0x532E023Eul, 0xA145813Dul,\n",
+        "        0x758FE5D6ul, 0x87E466D5ul, 0x94B49521ul, 0x66DF1622ul,\n",
+        "        0x38CC2A06ul, 0xCAA7A905ul, 0xD9F75AF1ul, 0x2B9CD9F2ul,\n",
+        "        0xFF56BD19ul, 0x0D3D3E1Aul, 0x1E6DCDEEul, 0xEC064EEDul,\n",
+        "        0xC38D26C4ul, 0x31E6A5C7ul, 0x22B65633ul, 0xD0DDD530ul,\n",
+        "        0x0417B1DBul, 0xF67C32D8ul, 0xE52CC12Cul, 0x1747422Ful,\n",
+        "        0x49547E0Bul, 0xBB3FFD08ul, 0xA86F0EFCul, 0x5A048DFFul,\n",
+        "        0x8ECEE914ul, 0x7CA56A17ul, 0x6FF599E3ul, 0x9D9E1AE0ul,\n",
+        "        0xD3D3E1ABul, 0x21B862A8ul, 0x32E8915Cul, 0xC083125Ful,\n",
+        "        0x144976B4ul, 0xE622F5B7ul, 0xF5720643ul, 0x07198540ul,\n",
+        "        0x590AB964ul, 0xAB613A67ul, 0xB831C993ul, 0x4A5A4A90ul,\n",
+        "        0x9E902E7Bul, 0x6CFBAD78ul, 0x7FAB5E8Cul, 0x8DC0DD8Ful,\n",
+        "        0xE330A81Aul, 0x115B2B19ul, 0x020BD8EDul, 0xF0605BEEul,\n",
+        "        0x24AA3F05ul, 0xD6C1BC06ul, 0xC5914FF2ul, 0x37FACCF1ul,\n",
+        "        0x69E9F0D5ul, 0x9B8273D6ul, 0x88D28022ul, 0x7AB90321ul,\n",
+        "        0xAE7367CAul, 0x5C18E4C9ul, 0x4F48173Dul, 0xBD23943Eul,\n",
+        "        0xF36E6F75ul, 0x0105EC76ul, 0x12551F82ul, 0xE03E9C81ul,\n",
+        "        0x34F4F86Aul, 0xC69F7B69ul, 0xD5CF889Dul, 0x27A40B9Eul,\n",
+        "        0x79B737BAul, 0x8BDCB4B9ul, 0x988C474Dul, 0x6AE7C44Eul,\n",
+        "        0xBE2DA0A5ul, 0x4C4623A6ul, 0x5F16D052ul, 0xAD7D5351ul\n",
+        "    };\n",
+        "\n",
+        "    while ( size > 0 )\n",
+        "    {\n",
+        "        crc =   table[( crc ^ *data ) & 255u] ^ ( ( crc & 0xFFFFFFFFul ) >> 8 );\n",
+        "        data += 1u;\n",
+        "        size -= 1u;\n",
+        "    }\n",
+        "\n",
+        "    return ( crc & 0xFFFFFFFFul );\n",
+        "#endif\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_crc32c function\n",
+        "*\n",
+        "*  Returns the CRC32C checksum of the \"size\" bytes at \"data\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CRC_API unsigned long bin2c_crc32c ( unsigned char const * data, size_t size )\n",
+        "{\n",
+        "    return ( bin2c_crc_update ( 0xFFFFFFFFul, data, size ) ^ 0xFFFFFFFFul );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_crc_verify function\n",
+        "*\n",
+        "*  Returns non-zero when the blocks of \"index\" that hold any of the \"size\" bytes\n",
+        "*  at \"offset\" match their checksums, given the whole data at \"data\" (of which\n",
+        "*  those blocks must be present in full).  Bytes past the data's end fail.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CRC_API int bin2c_crc_verify ( bin2c_crc_index const * index, unsigned char const * data, size_t offset, size_t size )\n",
+        "{\n",
+        "    size_t block;\n",
+        "    size_t last;\n",
+        "\n",
+        "    if ( ( offset > index->size ) || ( size > ( index->size - offset ) ) )\n",
+        "    {\n",
+        "        return ( 0 );\n",
+        "    }\n",
+        "\n",
+        "    if ( size == 0 )\n",
+        "    {\n",
+        "        return ( 1 );\n",
+        "    }\n",
+        "\n",
+        "    block = offset / index->blocksize;\n",
+        "    last =  ( offset + size - 1u ) / index->blocksize;\n",
+        "\n",
+        "    for ( ; block <= last; block += 1u )\n",
+        "    {\n",
+        "        size_t start;\n",
+        "        size_t length;\n",
+        "\n",
+        "        start =  block * index->blocksize;\n",
+        "        length = ( ( index->size - start ) < index->blocksize ) ? ( index->size - start ) : index->blocksize;\n",
+        "\n",
+        "        if ( bin2c_crc32c ( data + start, length ) != index->hashes[block] )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( 1 );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_crc.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runbin2c_outputdecoded function
+*
+*  This function outputs the declaration or definition of the number of bytes
+*  that the compressed array decodes to (i.e.: the size of the input binary
+*  file), with the "-c" option.
+*
+*  Parameter(s)
+*
+*  symbol:      pointer to the name of the array (usually the name of the input
+*               binary file, without the leading file path and without the
+*               trailing file extension)
+*  arguments:   pointer to the parameters of the command-line options
+*  compression: pointer to the description of the compressed data
+*  definition:  whether to output the definition of the "-l" option's constant
+*               (as opposed to its "extern" declaration)
+*  outfile:     pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the declaration or definition
+*
+*  Remarks
+*
+*  The name is the full name of the array without the "-s" option's suffix,
+*  followed by "_decoded".  Consistent with the number of elements, it is a
+*  capitalized macro, except with the "-l" option, which keeps the header file
+*  independent of the input binary file's data with an "extern size_t const"
+*  that the source file defines.  With the "-c auto" option, a stored array has
+*  it too (as its own size), so the decision changes no declaration.
+*/
+
+static bool main_runbin2c_outputdecoded
+(
+    char const * restrict             symbol,
+    main_arguments const * restrict   arguments,
+    main_compression const * restrict compression,
+    bool                              definition,
+    FILE * restrict                   outfile
+)
+{
+    bool success;
+
+    if ( arguments->extent != NULL )
+    {
+        int error;
+
+        error =   fputs ( definition ? "\nsize_t const " : "extern size_t const ",
+                          outfile );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_decoded",
+                                                outfile );
+
+        if ( definition )
+        {
+            error =    fprintf ( outfile,
+                                 " = %luul;\n",
+                                 compression->decoded );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( ";\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+
+    }
+    else
+    {
+        char * restrict macro;
+
+        macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                 symbol,
+                                                 "_decoded" );
+        success = macro != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#define %s  %luul\n\n",
+                                macro,
+                                compression->decoded );
+            success = error >= 0;
+
+            free ( macro );
+
+        }
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputcompressed function
+*
+*  This function outputs the declaration or definition of whether the "-c auto"
+*  option compressed the array (as opposed to storing it).
+*
+*  Parameter(s)
+*
+*  symbol:      pointer to the name of the array (usually the name of the input
+*               binary file, without the leading file path and without the
+*               trailing file extension)
+*  arguments:   pointer to the parameters of the command-line options
+*  definition:  whether to output the definition of the "-l" option's constant
+*               (as opposed to its "extern" declaration)
+*  outfile:     pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the declaration or definition
+*
+*  Remarks
+*
+*  The name is the full name of the array without the "-s" option's suffix,
+*  followed by "_compressed", and its value is 1 or 0.  Like the decoded size,
+*  it is a capitalized macro, except with the "-l" option, whose header file
+*  declares an "extern int const" that the source file defines.
+*/
+
+static bool main_runbin2c_outputcompressed
+(
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    bool                            definition,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+
+    if ( arguments->extent != NULL )
+    {
+        int error;
+
+        error =   fputs ( definition ? "\nint const " : "extern int const ",
+                          outfile );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_compressed",
+                                                outfile );
+
+        if ( definition )
+        {
+            error =    fprintf ( outfile,
+                                 " = %d;\n",
+                                 ( arguments->coding != MAIN_CODEC_NONE ) ? 1 : 0 );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( ";\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+
+    }
+    else
+    {
+        char * restrict macro;
+
+        macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                 symbol,
+                                                 "_compressed" );
+        success = macro != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#define %s  %d\n\n",
+                                macro,
+                                ( arguments->coding != MAIN_CODEC_NONE ) ? 1 : 0 );
+            success = error >= 0;
+
+            free ( macro );
+
+        }
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_compress_length function
+*
+*  This function outputs the part of a length in the LZ4 block format that does
+*  not fit in its token's nibble, as a run of 255s and a final, smaller byte.
+*
+*  Parameter(s)
+*
+*  cursor:  pointer to where the length's bytes go
+*  length:  the length minus the 15 that the token's nibble holds
+*
+*  Return value(s)
+*
+*  !=NULL:  pointer to the byte after the length's bytes
+*/
+
+static unsigned char * restrict main_runbin2c_compress_length
+(
+    unsigned char * restrict cursor,
+    size_t                   length
+)
+{
+
+    while ( length >= 255u )
+    {
+        *cursor =  255u;
+        cursor +=  1u;
+        length -=  255u;
+    }
+
+    *cursor = ( unsigned char ) length;
+
+    return ( cursor + 1u );
+}
+
+
+
+/*
+** main_runbin2c_compress_sequence function
+*
+*  This function outputs one sequence of the LZ4 block format: a token, the
+*  literals and, except for the last sequence, the match's offset and length.
+*
+*  Parameter(s)
+*
+*  cursor:    pointer to where the sequence goes
+*  literals:  pointer to the bytes that precede the match
+*  count:     number of literals
+*  distance:  distance back to the match's source; ignored for the last sequence
+*  match:     length of the match (at least four), or zero for the last sequence
+*
+*  Return value(s)
+*
+*  !=NULL:  pointer to the byte after the sequence
+*/
+
+static unsigned char * restrict main_runbin2c_compress_sequence
+(
+    unsigned char * restrict       cursor,
+    unsigned char const * restrict literals,
+    size_t                         count,
+    size_t                         distance,
+    size_t                         match
+)
+{
+    unsigned char * restrict token;
+
+    token =  cursor;
+    cursor += 1u;
+
+    if ( count >= 15u )
+    {
+        *token = 15u << 4;
+        cursor = main_runbin2c_compress_length ( cursor,
+                                                 count - 15u );
+    }
+    else
+    {
+        *token = ( unsigned char ) ( count << 4 );
+    }
+
+    memcpy ( cursor,
+             literals,
+             count );
+    cursor += count;
+
+    if ( match > 0 )
+    {
+
+        cursor[0] = ( unsigned char ) ( distance & 0xFFu );
+        cursor[1] = ( unsigned char ) ( distance >> 8 );
+        cursor +=   2u;
+
+        match -= 4u;
+
+        if ( match >= 15u )
+        {
+            *token |= 15u;
+            cursor = main_runbin2c_compress_length ( cursor,
+                                                     match - 15u );
+        }
+        else
+        {
+            *token |= ( unsigned char ) match;
+        }
+
+    }
+
+    return ( cursor );
+}
+
+
+
+/*
+** main_runbin2c_compress_hash function
+*
+*  This function hashes the four bytes at the given position, for the heads of
+*  the LZ compressor's chains.
+*
+*  Parameter(s)
+*
+*  data:  pointer to the four bytes to hash
+*
+*  Return value(s)
+*
+*  The hash, which is less than "1 << MAIN_LZHASHBITS".
+*/
+
+static unsigned int main_runbin2c_compress_hash
+(
+    unsigned char const * restrict data
+)
+{
+    unsigned long value;
+
+    value =  ( unsigned long ) data[0];
+    value |= ( unsigned long ) data[1] << 8;
+    value |= ( unsigned long ) data[2] << 16;
+    value |= ( unsigned long ) data[3] << 24;
+
+    value = ( value * 2654435761ul ) & 0xFFFFFFFFul;
+
+    return ( ( unsigned int ) ( value >> ( 32u - MAIN_LZHASHBITS ) ) );
+}
+
+
+
+/*
+** main_runbin2c_compress_lz function
+*
+*  This function is the LZ compressor, which converts a block of data into a
+*  block in the LZ4 block format.
+*
+*  Parameter(s)
+*
+*  input:   pointer to the dictionary, if any, followed by the data to compress
+*  start:   number of bytes of the dictionary (zero without the "-d" option)
+*  size:    number of bytes of the dictionary and the data
+*  window:  the window in bytes (a power of two that does not exceed
+*           "MAIN_LZWINDOW"), which bounds the distance of the matches
+*  head:    pointer to "1 << MAIN_LZHASHBITS" elements of scratch memory
+*  chain:   pointer to "window" elements of scratch memory
+*  output:  pointer to the buffer that receives the compressed block; must have
+*           room for "size + ( size / 255 ) + 16" bytes (not counting the
+*           dictionary)
+*
+*  Return value(s)
+*
+*  The number of bytes placed in "output".
+*
+*  Remarks
+*
+*  The compressor follows the rules of the LZ4 block format, so that any LZ4
+*  decoder can decode the output: the last five bytes are always literals and
+*  the last match starts at least twelve bytes before the end.  Matches never
+*  reach back as far as "window", so that a streaming decoder with a window of
+*  that size still has every match's source.  The chains link every position
+*  to the previous one with the same hash, in a ring as large as the window.
+*  The dictionary's positions join the chains before the data's, so that
+*  matches can refer back into the dictionary as if it preceded the data.
+*/
+
+static size_t main_runbin2c_compress_lz
+(
+    unsigned char const * restrict input,
+    size_t                         start,
+    size_t                         size,
+    unsigned long                  window,
+    unsigned long * restrict       head,
+    unsigned long * restrict       chain,
+    unsigned char * restrict       output
+)
+{
+    unsigned char * restrict cursor;
+    size_t                   anchor;
+
+    cursor = output;
+    anchor = start;
+
+    memset ( head,
+             0,
+             sizeof ( *head ) * ( 1u << MAIN_LZHASHBITS ) );
+
+    /*
+    ** Positions in the heads and chains are offset by one, so that zero means
+    *  that there is no earlier position with the same hash.
+    */
+
+    {
+        size_t next;
+
+        for ( next = 0; ( next < start ) && ( ( next + 4u ) <= size ); next += 1u )
+        {
+            unsigned int hash;
+
+            hash = main_runbin2c_compress_hash ( input + next );
+
+            chain[next & ( window - 1u )] = head[hash];
+            head[hash] =                    ( unsigned long ) next + 1u;
+        }
+    }
+
+    if ( size >= 13u )
+    {
+        size_t limit;
+        size_t end;
+        size_t position;
+
+        limit =    size - 12u;
+        end =      size - 5u;
+        position = start;
+
+        while ( position < limit )
+        {
+            unsigned long candidate;
+            unsigned int  depth;
+            size_t        best;
+            size_t        distance;
+            unsigned int  hash;
+
+            /*
+            ** A long run of the byte that precedes the position is a match at
+            *  a distance of one, which the decoder expands like "memset".
+            *  Only the run's last positions join the chains, given that all
+            *  the others would hash alike.
+            */
+
+            if ( ( position > 0 ) && ( input[position] == input[position - 1u] ) )
+            {
+                size_t run;
+
+                run = main_runbin2c_measurerun ( input + position,
+                                                 end - position,
+                                                 input[position - 1u] );
+
+                if ( run >= MAIN_LZRUN )
+                {
+                    size_t next;
+
+                    cursor = main_runbin2c_compress_sequence ( cursor,
+                                                               input + anchor,
+                                                               position - anchor,
+                                                               1u,
+                                                               run );
+
+                    position += run;
+                    anchor =    position;
+
+                    for ( next = position - 3u; ( next < position ) && ( next < limit ); next += 1u )
+                    {
+                        hash = main_runbin2c_compress_hash ( input + next );
+
+                        chain[next & ( window - 1u )] = head[hash];
+                        head[hash] =                    ( unsigned long ) next + 1u;
+                    }
+
+                    continue;
+                }
+            }
+
+            hash =      main_runbin2c_compress_hash ( input + position );
+            candidate = head[hash];
+
+            chain[position & ( window - 1u )] = candidate;
+            head[hash] =                        ( unsigned long ) position + 1u;
+
+            best =     0;
+            distance = 0;
+
+            for ( depth = MAIN_LZDEPTH; ( candidate != 0 ) && ( depth > 0 ); depth -= 1u )
+            {
+                size_t source;
+                size_t length;
+
+                source = ( size_t ) candidate - 1u;
+
+                if ( ( position - source ) >= window )
+                {
+                    break;
+                }
+
+                length = 0;
+
+                while ( ( ( position + length ) < end ) && ( input[source + length] == input[position + length] ) )
+                {
+                    length += 1u;
+                }
+
+                if ( length > best )
+                {
+                    best =     length;
+                    distance = position - source;
+                }
+
+                candidate = chain[source & ( window - 1u )];
+            }
+
+            /*
+            ** A match must be at least four bytes long.  The positions it
+            *  covers still join the chains, so that later matches can refer
+            *  back into it.
+            */
+
+            if ( best >= 4u )
+            {
+                size_t next;
+
+                cursor = main_runbin2c_compress_sequence ( cursor,
+                                                           input + anchor,
+                                                           position - anchor,
+                                                           distance,
+                                                           best );
+
+                for ( next = position + 1u; ( next < ( position + best ) ) && ( next < limit ); next += 1u )
+                {
+                    hash = main_runbin2c_compress_hash ( input + next );
+
+                    chain[next & ( window - 1u )] = head[hash];
+                    head[hash] =                    ( unsigned long ) next + 1u;
+                }
+
+                position += best;
+                anchor =    position;
+            }
+            else
+            {
+                position += 1u;
+            }
+
+        }
+
+    }
+
+    cursor = main_runbin2c_compress_sequence ( cursor,
+                                               input + anchor,
+                                               size - anchor,
+                                               0,
+                                               0 );
+
+    return ( ( size_t ) ( cursor - output ) );
+}
+
+
+
+/*
+** main_runbin2c_compress_number function
+*
+*  This function outputs a number of the delta format of the "-v" option, in
+*  seven bits per byte, least significant first, with the top bit set on all
+*  bytes but the last.
+*
+*  Parameter(s)
+*
+*  cursor:  pointer to where the number's bytes go
+*  value:   the number
+*
+*  Return value(s)
+*
+*  !=NULL:  pointer to the byte after the number's bytes
+*/
+
+static unsigned char * restrict main_runbin2c_compress_number
+(
+    unsigned char * restrict cursor,
+    size_t                   value
+)
+{
+
+    while ( value >= 128u )
+    {
+        *cursor = ( unsigned char ) ( ( value & 127u ) | 128u );
+        cursor += 1u;
+        value >>= 7;
+    }
+
+    *cursor = ( unsigned char ) value;
+
+    return ( cursor + 1u );
+}
+
+
+
+/*
+** main_runbin2c_compress_operation function
+*
+*  This function outputs the operations of the delta format of the "-v"
+*  option for literals and the copy from the base that follows them.
+*
+*  Parameter(s)
+*
+*  cursor:    pointer to where the operations go
+*  literals:  pointer to the bytes that precede the copy
+*  count:     number of literals, or zero for no literal operation
+*  start:     the offset in the base of the copy's source
+*  length:    length of the copy, or zero for no copy operation
+*  expected:  the offset in the base where the previous copy ended
+*
+*  Return value(s)
+*
+*  !=NULL:  pointer to the byte after the operations
+*/
+
+static unsigned char * restrict main_runbin2c_compress_operation
+(
+    unsigned char * restrict       cursor,
+    unsigned char const * restrict literals,
+    size_t                         count,
+    size_t                         start,
+    size_t                         length,
+    size_t                         expected
+)
+{
+
+    if ( count > 0 )
+    {
+        cursor = main_runbin2c_compress_number ( cursor,
+                                                 count << 1 );
+
+        memcpy ( cursor,
+                 literals,
+                 count );
+        cursor += count;
+    }
+
+    /*
+    ** The distance from where the previous copy ended is even when it is
+    *  forward and odd when it is backward, so that a copy that continues the
+    *  previous one has a distance of zero.
+    */
+
+    if ( length > 0 )
+    {
+        cursor = main_runbin2c_compress_number ( cursor,
+                                                 ( length << 1 ) | 1u );
+        cursor = main_runbin2c_compress_number ( cursor,
+                                                 ( start >= expected ) ? ( ( start - expected ) << 1 ) : ( ( ( expected - start - 1u ) << 1 ) | 1u ) );
+    }
+
+    return ( cursor );
+}
+
+
+
+/*
+** main_runbin2c_compress_locate function
+*
+*  This function hashes the "MAIN_DELTAMINIMUM" bytes at the given position,
+*  for the index of the base of the "-v" option.
+*
+*  Parameter(s)
+*
+*  data:  pointer to the bytes to hash
+*
+*  Return value(s)
+*
+*  The hash, which is less than "1 << MAIN_DELTAHASHBITS".
+*/
+
+static unsigned long main_runbin2c_compress_locate
+(
+    unsigned char const * restrict data
+)
+{
+    unsigned long hash;
+    unsigned int  index;
+
+    CHECK ( MAIN_DELTAMINIMUM >= 4u );
+
+    hash = 0;
+
+    for ( index = 0; index < MAIN_DELTAMINIMUM; index += 1u )
+    {
+        hash = ( ( hash ^ ( unsigned long ) data[index] ) * 2654435761ul ) & 0xFFFFFFFFul;
+    }
+
+    return ( hash >> ( 32u - MAIN_DELTAHASHBITS ) );
+}
+
+
+
+/*
+** main_runbin2c_compress_delta function
+*
+*  This function is the delta encoder of the "-v" option, which converts the
+*  data of an input binary file into literals and copies from the base.
+*
+*  Parameter(s)
+*
+*  input:     pointer to the data to encode
+*  size:      number of bytes of the data
+*  base:      pointer to the base's data
+*  basesize:  number of bytes of the base's data
+*  head:      pointer to "1 << MAIN_DELTAHASHBITS" elements of scratch memory
+*  output:    pointer to the buffer that receives the delta; must have room for
+*             "size + ( size / 255 ) + 16" bytes
+*
+*  Return value(s)
+*
+*  The number of bytes placed in "output".
+*
+*  Remarks
+*
+*  Variants mostly line up with the base, so the encoder first tries to
+*  continue where the previous copy ended, which only costs a single byte of
+*  distance.  Failing that, it looks the data up in an index of the base,
+*  which holds every "step"-th position of the base (so that it never has more
+*  positions than elements), so data that moved is found at most a step after
+*  it starts to match, and the copy then reaches back over the literals before
+*  it.  A copy must save more bytes than the longest number takes, so that the
+*  delta never exceeds the data by more than a single number.
+*/
+
+static size_t main_runbin2c_compress_delta
+(
+    unsigned char const * restrict input,
+    size_t                         size,
+    unsigned char const * restrict base,
+    size_t                         basesize,
+    unsigned long * restrict       head,
+    unsigned char * restrict       output
+)
+{
+    unsigned char * restrict cursor;
+    size_t                   anchor;
+    size_t                   expected;
+    size_t                   position;
+    size_t                   longest;
+
+    cursor =   output;
+    anchor =   0;
+    expected = 0;
+    position = 0;
+    longest =  ( ( sizeof ( size_t ) * CHAR_BIT ) + 6u ) / 7u;
+
+    memset ( head,
+             0,
+             sizeof ( *head ) * ( 1ul << MAIN_DELTAHASHBITS ) );
+
+    /*
+    ** Positions in the index are offset by one, so that zero means that no
+    *  position of the base has the hash.
+    */
+
+    {
+        size_t step;
+        size_t next;
+
+        step = ( basesize >> MAIN_DELTAHASHBITS ) + 1u;
+
+        for ( next = 0; ( next + MAIN_DELTAMINIMUM ) <= basesize; next += step )
+        {
+            head[main_runbin2c_compress_locate ( base + next )] = ( unsigned long ) next + 1u;
+        }
+    }
+
+    while ( ( position + MAIN_DELTAMINIMUM ) <= size )
+    {
+        size_t        start;
+        size_t        length;
+        size_t        candidate;
+        size_t        back;
+        size_t        cost;
+        unsigned char scratch[32];
+
+        start =  expected;
+        length = 0;
+
+        while ( ( ( start + length ) < basesize ) && ( ( position + length ) < size ) && ( base[start + length] == input[position + length] ) )
+        {
+            length += 1u;
+        }
+
+        candidate = ( size_t ) head[main_runbin2c_compress_locate ( input + position )];
+
+        if ( ( length < MAIN_DELTAMINIMUM ) && ( candidate != 0 ) )
+        {
+            size_t other;
+
+            candidate -= 1u;
+            other =      0;
+
+            while ( ( ( candidate + other ) < basesize ) && ( ( position + other ) < size ) && ( base[candidate + other] == input[position + other] ) )
+            {
+                other += 1u;
+            }
+
+            if ( other > length )
+            {
+                start =  candidate;
+                length = other;
+            }
+        }
+
+        back = 0;
+
+        while ( ( length > 0 ) && ( start > back ) && ( ( position - back ) > anchor ) && ( base[start - back - 1u] == input[position - back - 1u] ) )
+        {
+            back += 1u;
+        }
+
+        cost = ( size_t ) ( main_runbin2c_compress_operation ( scratch,
+                                                               NULL,
+                                                               0,
+                                                               start - back,
+                                                               length + back,
+                                                               expected ) - scratch );
+
+        if ( ( ( length + back ) >= MAIN_DELTAMINIMUM ) && ( ( length + back ) > ( cost + longest ) ) )
+        {
+            start -=    back;
+            position -= back;
+            length +=   back;
+
+            cursor = main_runbin2c_compress_operation ( cursor,
+                                                        input + anchor,
+                                                        position - anchor,
+                                                        start,
+                                                        length,
+                                                        expected );
+
+            position += length;
+            anchor =    position;
+            expected =  start + length;
+        }
+        else
+        {
+            position += 1u;
+        }
+
+    }
+
+    cursor = main_runbin2c_compress_operation ( cursor,
+                                                input + anchor,
+                                                size - anchor,
+                                                0,
+                                                0,
+                                                expected );
+
+    return ( ( size_t ) ( cursor - output ) );
+}
+
+
+
+/*
+** main_runbin2c_compress function
+*
+*  This function compresses the input binary file with the "-c" option's codec
+*  into a temporary file, from which the encoder then reads.
+*
+*  Parameter(s)
+*
+*  infile:       pointer to the "FILE" object for the input binary file
+*  arguments:    pointer to the parameters of the command-line options
+*  compression:  pointer to the description of the compressed data, which this
+*                function fills in; the caller must free its "blocks" member
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as a heap allocation failing
+*  !=NULL:  success; pointer to the "FILE" object for the compressed data, at
+*           its start, which the caller must close
+*
+*  Remarks
+*
+*  Unlike the rest of this program, the compressor needs a whole block of the
+*  input binary file in memory, given that matches may refer back to any
+*  earlier data of the block (or of the dictionary, which precedes every block
+*  in the same heap allocation).  Without the "-k" option, the whole file is a
+*  single block.  Staging the compressed data in a temporary file means that
+*  the rest of this program processes it exactly like an input binary file.
+*  The delta of the "-v" option is a codec like any other in that respect.
+*/
+
+static FILE * main_runbin2c_compress
+(
+    FILE * restrict                 infile,
+    main_arguments const * restrict arguments,
+    main_compression * restrict     compression
+)
+{
+    bool                     success;
+    unsigned char * restrict input;
+    unsigned char * restrict output;
+    unsigned long * restrict head;
+    unsigned long * restrict chain;
+    size_t                   capacity;
+    size_t                   bound;
+    size_t                   limit;
+    size_t                   prefix;
+    unsigned long            hashes;
+    unsigned long            listed;
+    unsigned long            total;
+    FILE * restrict          outfile;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *input ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( ( SIZE_MAX / sizeof ( *head ) ) >= ( 1u << MAIN_LZHASHBITS ) );
+
+    compression->decoded = 0;
+    compression->encoded = 0;
+    compression->blocks =  NULL;
+    compression->count =   0;
+
+    /*
+    ** The block size is validated to fit in a "size_t", whereas the input
+    *  binary file's size is limited to what the heap can hold.
+    */
+
+    prefix =   ( size_t ) arguments->dictsize;
+    limit =    ( arguments->blocksize > 0 ) ? ( size_t ) arguments->blocksize : ( SIZE_MAX - prefix );
+    capacity = ( limit < MAIN_CHUNKSIZE ) ? limit : MAIN_CHUNKSIZE;
+    bound =    0;
+    listed =   0;
+    total =    0;
+    output =   NULL;
+
+    input =    ( unsigned char * ) malloc ( sizeof ( *input ) * ( prefix + capacity ) );
+    success =  input != NULL;
+
+    if ( success && ( prefix > 0 ) )
+    {
+        memcpy ( input,
+                 arguments->trained,
+                 prefix );
+    }
+
+    hashes =   ( arguments->coding == MAIN_CODEC_DELTA ) ? ( 1ul << MAIN_DELTAHASHBITS ) : ( 1ul << MAIN_LZHASHBITS );
+    success &= hashes <= ( SIZE_MAX / sizeof ( *head ) );
+    head =     success ? ( unsigned long * ) malloc ( sizeof ( *head ) * ( size_t ) hashes ) : NULL;
+    success &= head != NULL;
+
+    success &= arguments->windowsize <= ( SIZE_MAX / sizeof ( *chain ) );
+    chain =    success ? ( unsigned long * ) malloc ( sizeof ( *chain ) * ( size_t ) arguments->windowsize ) : NULL;
+    success &= chain != NULL;
+
+    if ( success && ( arguments->blocksize > 0 ) )
+    {
+        listed =              64u;
+        compression->blocks = ( unsigned long * ) malloc ( sizeof ( *compression->blocks ) * listed );
+        success =             compression->blocks != NULL;
+    }
+
+    outfile =  success ? tmpfile ( ) : NULL;
+    success &= outfile != NULL;
+
+    while ( success )
+    {
+        size_t size;
+        size_t count;
+
+        /*
+        ** A block's data accumulates in a heap allocation that doubles in
+        *  capacity whenever it is full (up to the block size).
+        */
+
+        size = 0;
+
+        while ( success && ( size < limit ) )
+        {
+
+            if ( size == capacity )
+            {
+                unsigned char * restrict larger;
+
+                capacity = ( capacity <= ( limit / 2u ) ) ? ( capacity * 2u ) : limit;
+
+                larger =  ( unsigned char * ) realloc ( input,
+                                                        sizeof ( *input ) * ( prefix + capacity ) );
+                success = larger != NULL;
+
+                if ( success )
+                {
+                    input = larger;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            count = fread ( input + prefix + size,
+                            sizeof ( *input ),
+                            capacity - size,
+                            infile );
+            size += count;
+
+            if ( ferror ( infile ) )
+            {
+                success = false;
+            }
+
+            if ( feof ( infile ) )
+            {
+                break;
+            }
+
+        }
+
+        /*
+        ** Without a block size, even an empty input binary file has its
+        *  single (empty) block, whereas blocks never end with an empty one.
+        */
+
+        if ( !success || ( ( size == 0 ) && ( ( compression->count > 0 ) || ( arguments->blocksize > 0 ) ) ) )
+        {
+            break;
+        }
+
+        if ( ( arguments->blocksize == 0 ) && ( size == limit ) )
+        {
+            success = false;
+            break;
+        }
+
+        if ( bound < ( size + ( size / 255u ) + 16u ) )
+        {
+            unsigned char * restrict larger;
+
+            bound =   size + ( size / 255u ) + 16u;
+            success = bound > size;
+
+            larger =  success ? ( unsigned char * ) realloc ( output,
+                                                              sizeof ( *output ) * bound ) : NULL;
+            success = larger != NULL;
+
+            if ( success )
+            {
+                output = larger;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        /*
+        ** The block index has an element per block and a final one for the
+        *  length of the compressed data, so that every block's compressed size
+        *  is the difference of consecutive elements.
+        */
+
+        if ( ( arguments->blocksize > 0 ) && ( ( compression->count + 1u ) >= listed ) )
+        {
+            unsigned long * restrict larger;
+
+            success = listed <= ( ( SIZE_MAX / sizeof ( *larger ) ) / 2u );
+            listed *= 2u;
+
+            larger =  success ? ( unsigned long * ) realloc ( compression->blocks,
+                                                              sizeof ( *larger ) * listed ) : NULL;
+            success = larger != NULL;
+
+            if ( success )
+            {
+                compression->blocks = larger;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if ( arguments->coding == MAIN_CODEC_DELTA )
+        {
+            count = main_runbin2c_compress_delta ( input,
+                                                   size,
+                                                   arguments->baseline,
+                                                   ( size_t ) arguments->basesize,
+                                                   head,
+                                                   output );
+        }
+        else
+        {
+            count = main_runbin2c_compress_lz ( input,
+                                                prefix,
+                                                prefix + size,
+                                                arguments->windowsize,
+                                                head,
+                                                chain,
+                                                output );
+        }
+
+        success = fwrite ( output,
+                           sizeof ( *output ),
+                           count,
+                           outfile ) == count;
+
+        if ( arguments->blocksize > 0 )
+        {
+            compression->blocks[compression->count] = total;
+        }
+
+        success &= count <= ( unsigned long ) ( LONG_MAX - total );
+        success &= size <= ( unsigned long ) ( LONG_MAX - compression->decoded );
+
+        total +=                ( unsigned long ) count;
+        compression->decoded += ( unsigned long ) size;
+        compression->count +=   1u;
+
+        if ( ( size < limit ) || feof ( infile ) )
+        {
+            break;
+        }
+
+    }
+
+    if ( success && ( arguments->blocksize > 0 ) )
+    {
+        compression->blocks[compression->count] = total;
+    }
+
+    compression->encoded = total;
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+        rewind ( outfile );
+
+    }
+
+    if ( output != NULL )
+    {
+        free ( output );
+    }
+
+    if ( chain != NULL )
+    {
+        free ( chain );
+    }
+
+    if ( head != NULL )
+    {
+        free ( head );
+    }
+
+    if ( input != NULL )
+    {
+        free ( input );
+    }
+
+    if ( !success && ( outfile != NULL ) )
+    {
+        fclose ( outfile );
+        outfile = NULL;
+    }
+
+    return ( outfile );
+}
+
+
+
+/*
+** main_runbin2c_digest_update function
+*
+*  This function updates a CRC32C register with data, with the processor's
+*  CRC32C instructions where "MAIN_CRC32C" is present and with a table
+*  elsewhere (and for the bytes that do not fill a word).
+*
+*  Parameter(s)
+*
+*  table:  pointer to the 256 elements of the table of the reflected CRC32C
+*          polynomial, as "main_runbin2c_digest" computes it
+*  crc:    the register (i.e.: the complement of the checksum so far)
+*  data:   pointer to the data
+*  size:   number of bytes of the data
+*
+*  Return value(s)
+*
+*  The updated register.
+*/
+
+static unsigned long main_runbin2c_digest_update
+(
+    unsigned long const * restrict table,
+    unsigned long                  crc,
+    unsigned char const * restrict data,
+    size_t                         size
+)
+{
+#if defined ( MAIN_CRC32C )
+
+    while ( size >= 4u )
+    {
+        crc =  ( unsigned long ) MAIN_CRC32C ( ( unsigned int ) crc,
+                                               ( unsigned int ) data[0] | ( ( unsigned int ) data[1] << 8 ) | ( ( unsigned int ) data[2] << 16 ) | ( ( unsigned int ) data[3] << 24 ) );
+        data += 4u;
+        size -= 4u;
+    }
+
+#endif
+
+    while ( size > 0 )
+    {
+        crc =  table[( crc ^ *data ) & 255u] ^ ( crc >> 8 );
+        data += 1u;
+        size -= 1u;
+    }
+
+    return ( crc );
+}
+
+
+
+/*
+** main_runbin2c_digest function
+*
+*  This function computes the CRC32C checksums of the input binary file's data,
+*  with the "-k" option's "crc32c:" item: of the whole data and of every block
+*  of the item's size.
+*
+*  Parameter(s)
+*
+*  infile:       pointer to the "FILE" object for the input binary file, which
+*                is at its start both before and after this function
+*  arguments:    pointer to the parameters of the command-line options
+*  compression:  pointer to the description of the data, whose "checksum",
+*                "hashes" and "hashed" members this function fills in; the
+*                caller must free its "hashes" member
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as a heap allocation failing
+*  !=false:  success; the members hold the checksums
+*
+*  Remarks
+*
+*  The checksums are of the input binary file's data even with the "-c"
+*  option, which the decoder produces again, so that a program verifies what
+*  it actually reads.  Their blocks need not be the compressed blocks, whose
+*  size is the "-k" option's other item.  Like the block index,
+*  the blocks never end with an empty one, so an empty input binary file has
+*  no blocks (and a checksum of zero).
+*/
+
+static bool main_runbin2c_digest
+(
+    FILE * restrict                 infile,
+    main_arguments const * restrict arguments,
+    main_compression * restrict     compression
+)
+{
+    bool                     success;
+    unsigned long            table[256];
+    unsigned char * restrict buffer;
+    unsigned long            listed;
+    unsigned long            crc;
+    unsigned long            block;
+    unsigned long            filled;
+    unsigned int             index;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+
+    for ( index = 0; index < 256u; index += 1u )
+    {
+        unsigned long entry;
+        unsigned int  bit;
+
+        entry = index;
+
+        for ( bit = 0; bit < 8u; bit += 1u )
+        {
+            entry = ( ( entry & 1u ) != 0 ) ? ( ( entry >> 1 ) ^ 0x82F63B78ul ) : ( entry >> 1 );
+        }
+
+        table[index] = entry;
+    }
+
+    compression->checksum = 0;
+    compression->hashed =   0;
+
+    listed = 64u;
+    crc =    0xFFFFFFFFul;
+    block =  0xFFFFFFFFul;
+    filled = 0;
+
+    buffer =              ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    compression->hashes = ( unsigned long * ) malloc ( sizeof ( *compression->hashes ) * listed );
+    success =             ( buffer != NULL ) && ( compression->hashes != NULL );
+
+    while ( success )
+    {
+        unsigned char const * data;
+        size_t                count;
+
+        count = fread ( buffer,
+                        sizeof ( *buffer ),
+                        MAIN_CHUNKSIZE,
+                        infile );
+        data =  buffer;
+
+        if ( ferror ( infile ) )
+        {
+            success = false;
+            break;
+        }
+
+        crc = main_runbin2c_digest_update ( table,
+                                            crc,
+                                            data,
+                                            count );
+
+        /*
+        ** A block's checksum is complete once the block is full, which may
+        *  happen several times per chunk (or once per several chunks).
+        */
+
+        while ( success && ( count > 0 ) )
+        {
+            size_t run;
+
+            run = ( size_t ) ( arguments->hashsize - filled );
+
+            if ( run > count )
+            {
+                run = count;
+            }
+
+            block =  main_runbin2c_digest_update ( table,
+                                                   block,
+                                                   data,
+                                                   run );
+            filled += ( unsigned long ) run;
+            count -=  run;
+            data +=   run;
+
+            if ( filled == arguments->hashsize )
+            {
+                if ( ( compression->hashed + 1u ) >= listed )
+                {
+                    unsigned long * restrict larger;
+
+                    success = listed <= ( ( SIZE_MAX / sizeof ( *larger ) ) / 2u );
+                    listed *= 2u;
+
+                    larger =  success ? ( unsigned long * ) realloc ( compression->hashes,
+                                                                      sizeof ( *larger ) * listed ) : NULL;
+                    success = larger != NULL;
+
+                    if ( success )
+                    {
+                        compression->hashes = larger;
+                    }
+                }
+
+                if ( success )
+                {
+                    compression->hashes[compression->hashed] = block ^ 0xFFFFFFFFul;
+                    compression->hashed +=                     1u;
+                }
+
+                block =  0xFFFFFFFFul;
+                filled = 0;
+            }
+        }
+
+        if ( feof ( infile ) )
+        {
+            break;
+        }
+    }
+
+    /*
+    ** The hashes have room for the last, partial block, given that a full one
+    *  always leaves room for another.
+    */
+
+    if ( success && ( filled > 0 ) )
+    {
+        compression->hashes[compression->hashed] = block ^ 0xFFFFFFFFul;
+        compression->hashed +=                     1u;
+    }
+
+    compression->checksum = crc ^ 0xFFFFFFFFul;
+
+    rewind ( infile );
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_choose_log2 function
+*
+*  This function computes the base-2 logarithm of a count, for the entropy
+*  estimate of "main_runbin2c_choose".
+*
+*  Parameter(s)
+*
+*  value:  the count, which must be at least one
+*
+*  Return value(s)
+*
+*  The logarithm, to within a sixteenth of a thousandth.
+*
+*  Remarks
+*
+*  The integer part is the number of halvings that bring the count below two,
+*  and each bit of the fraction is whether squaring the remainder reaches two.
+*  This keeps the program free of the math library for a single logarithm.
+*/
+
+static double main_runbin2c_choose_log2
+(
+    unsigned long value
+)
+{
+    double       result;
+    double       remainder;
+    double       bit;
+    unsigned int index;
+
+    result =    0.0;
+    remainder = ( double ) value;
+
+    while ( remainder >= 2.0 )
+    {
+        remainder /= 2.0;
+        result +=    1.0;
+    }
+
+    bit = 1.0;
+
+    for ( index = 0; index < 16u; index += 1u )
+    {
+
+        remainder *= remainder;
+        bit /=       2.0;
+
+        if ( remainder >= 2.0 )
+        {
+            remainder /= 2.0;
+            result +=    bit;
+        }
+
+    }
+
+    return ( result );
+}
+
+
+
+/*
+** main_runbin2c_choose function
+*
+*  This function decides, with the "-c auto" option, whether compressing the
+*  input binary file is worth it, and reports a decision to store it on the
+*  standard error pipe.
+*
+*  Parameter(s)
+*
+*  infile:     pointer to the "FILE" object for the input binary file, which is
+*              at its start both before and after this function
+*  symbol:     pointer to the name of the array, which the report starts with
+*  arguments:  pointer to the parameters of the command-line options
+*  coding:     pointer to the variable that receives the codec for the array
+*  entropy:    pointer to the variable that receives the entropy estimate of the
+*              data, in hundredths of a bit per byte
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as the input binary file not being
+*            readable
+*  !=false:  success; "*coding" and "*entropy" hold the decision
+*
+*  Remarks
+*
+*  The decision rests on a byte histogram of the whole input binary file and on
+*  the signature at its start.  Formats that are already compressed, files too
+*  small for matches to pay off (unless a shared dictionary provides them) and
+*  data whose order-0 entropy reaches "MAIN_AUTOENTROPY" are stored, so that
+*  the compressor only runs when it has a chance.  The caller reports the
+*  outcome of compressing, which may still reveal that storing is better.
+*
+*  Only the codec depends on the data.  The "text" form's string literal and
+*  the "constexpr" form's words change the array's type and names, so choosing
+*  them here would make the header file depend on the data, as the decoded size
+*  and "_compressed" avoid; the "-m" option selects them instead.
+*/
+
+static bool main_runbin2c_choose
+(
+    FILE * restrict                 infile,
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    main_codec * restrict           coding,
+    unsigned long * restrict        entropy
+)
+{
+    static struct
+    {
+        char const *  name;
+        size_t        size;
+        unsigned char bytes[8];
+    } const signatures[] =
+    {
+        { "PNG",   8u, { 0x89u, 0x50u, 0x4Eu, 0x47u, 0x0Du, 0x0Au, 0x1Au, 0x0Au } },
+        { "JPEG",  3u, { 0xFFu, 0xD8u, 0xFFu } },
+        { "GIF",   4u, { 0x47u, 0x49u, 0x46u, 0x38u } },
+        { "zip",   4u, { 0x50u, 0x4Bu, 0x03u, 0x04u } },
+        { "zip",   4u, { 0x50u, 0x4Bu, 0x05u, 0x06u } },
+        { "gzip",  2u, { 0x1Fu, 0x8Bu } },
+        { "bzip2", 3u, { 0x42u, 0x5Au, 0x68u } },
+        { "xz",    6u, { 0xFDu, 0x37u, 0x7Au, 0x58u, 0x5Au, 0x00u } },
+        { "7z",    6u, { 0x37u, 0x7Au, 0xBCu, 0xAFu, 0x27u, 0x1Cu } },
+        { "zstd",  4u, { 0x28u, 0xB5u, 0x2Fu, 0xFDu } },
+        { "LZ4",   4u, { 0x04u, 0x22u, 0x4Du, 0x18u } }
+    };
+
+    bool                     success;
+    unsigned char * restrict buffer;
+    unsigned long * restrict histogram;
+    unsigned long            total;
+    char const *             format;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( MAIN_CHUNKSIZE >= 8u );
+
+    *coding =  MAIN_CODEC_NONE;
+    *entropy = 0;
+    total =    0;
+    format =   NULL;
+
+    buffer =    ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    success =   buffer != NULL;
+
+    histogram = ( unsigned long * ) calloc ( 256u,
+                                             sizeof ( *histogram ) );
+    success &=  histogram != NULL;
+
+    while ( success )
+    {
+        size_t count;
+        size_t index;
+
+        count = fread ( buffer,
+                        sizeof ( *buffer ),
+                        MAIN_CHUNKSIZE,
+                        infile );
+
+        if ( ferror ( infile ) )
+        {
+            success = false;
+            break;
+        }
+
+        /*
+        ** Only the first chunk holds the signature (the rest of the first
+        *  chunk's bytes still count towards the histogram).
+        */
+
+        if ( total == 0 )
+        {
+            size_t signature;
+
+            for ( signature = 0; signature < ( sizeof ( signatures ) / sizeof ( *signatures ) ); signature += 1u )
+            {
+                if ( ( count >= signatures[signature].size ) && ( memcmp ( buffer,
+                                                                           signatures[signature].bytes,
+                                                                           signatures[signature].size ) == 0 ) )
+                {
+                    format = signatures[signature].name;
+                    break;
+                }
+            }
+        }
+
+        for ( index = 0; index < count; index += 1u )
+        {
+            histogram[buffer[index]] += 1u;
+        }
+
+        success &= count <= ( ULONG_MAX - total );
+        total +=   ( unsigned long ) count;
+
+        if ( feof ( infile ) )
+        {
+            break;
+        }
+    }
+
+    rewind ( infile );
+
+    /*
+    ** The order-0 entropy is "log2 ( total ) - sum ( n * log2 ( n ) ) / total"
+    *  over the histogram's non-zero counts "n".
+    */
+
+    if ( success && ( total > 0 ) )
+    {
+        double       sum;
+        double       bits;
+        unsigned int value;
+
+        sum = 0.0;
+
+        for ( value = 0; value < 256u; value += 1u )
+        {
+            if ( histogram[value] > 0 )
+            {
+                sum += ( double ) histogram[value] * main_runbin2c_choose_log2 ( histogram[value] );
+            }
+        }
+
+        bits = main_runbin2c_choose_log2 ( total ) - ( sum / ( double ) total );
+
+        *entropy = ( bits > 0.0 ) ? ( unsigned long ) ( ( bits * 100.0 ) + 0.5 ) : 0;
+    }
+
+    if ( success )
+    {
+        if ( format != NULL )
+        {
+            ( void ) fprintf ( stderr,
+                               "%s: stored, because it is already compressed (%s)\n",
+                               symbol,
+                               format );
+        }
+        else if ( ( total < MAIN_AUTOMINIMUM ) && ( arguments->dictionary == NULL ) )
+        {
+            ( void ) fprintf ( stderr,
+                               "%s: stored, because %lu bytes are too few to compress\n",
+                               symbol,
+                               total );
+        }
+        else if ( *entropy >= MAIN_AUTOENTROPY )
+        {
+            ( void ) fprintf ( stderr,
+                               "%s: stored, because its entropy of %lu.%02lu bits per byte is too high to compress\n",
+                               symbol,
+                               *entropy / 100u,
+                               *entropy % 100u );
+        }
+        else
+        {
+            *coding = MAIN_CODEC_LZ;
+        }
+    }
+
+    if ( histogram != NULL )
+    {
+        free ( histogram );
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputblob function
+*
+*  This function outputs the declarations or definitions of the block index and
+*  the "bin2c_lz_blob" description of the array, with the "-k" option.
+*
+*  Parameter(s)
+*
+*  symbol:       pointer to the name of the array (usually the name of the input
+*                binary file, without the leading file path and without the
+*                trailing file extension)
+*  arguments:    pointer to the parameters of the command-line options
+*  compression:  pointer to the description of the compressed data
+*  definition:   whether to output the definitions (as opposed to "extern"
+*                declarations, which only output header files with global scope
+*                need)
+*  outfile:      pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the declarations or definitions
+*
+*  Remarks
+*
+*  The names are the full name of the array without the "-s" option's suffix,
+*  followed by "_blocks" and "_blob", respectively.  The definitions take the
+*  same scope and form as the array's definition.
+*/
+
+static bool main_runbin2c_outputblob
+(
+    char const * restrict             symbol,
+    main_arguments const * restrict   arguments,
+    main_compression const * restrict compression,
+    bool                              definition,
+    FILE * restrict                   outfile
+)
+{
+    bool success;
+    bool external;
+    int  pass;
+
+    success =  true;
+    external = ( arguments->global != NULL ) || ( arguments->extent != NULL );
+
+    /*
+    ** The index and the description share the specifiers that precede them,
+    *  so the same steps output both of them, one per pass.
+    */
+
+    for ( pass = 0; success && ( pass < 2 ); pass += 1 )
+    {
+        int error;
+
+        if ( !definition )
+        {
+            error =    fputs ( "extern ",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( "\n",
+                               outfile );
+            success &= error >= 0;
+
+            if ( arguments->form == MAIN_FORM_INLINE )
+            {
+                success &= main_runbin2c_outputinline ( outfile );
+            }
+            else if ( !external )
+            {
+                error =    fputs ( "static ",
+                                   outfile );
+                success &= error >= 0;
+            }
+        }
+
+        error =    fputs ( ( pass == 0 ) ? "unsigned long const " : "bin2c_lz_blob const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                ( pass == 0 ) ? "_blocks" : "_blob",
+                                                outfile );
+
+        if ( !definition )
+        {
+            error =    fputs ( ( pass == 0 ) ? "[];\n" : ";\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else if ( pass == 0 )
+        {
+            unsigned long index;
+
+            error =    fputs ( "[] =\n{",
+                               outfile );
+            success &= error >= 0;
+
+            for ( index = 0; success && ( index <= compression->count ); index += 1u )
+            {
+                error =    fprintf ( outfile,
+                                     ( ( index % 8u ) == 0 ) ? "%s\n    %luul" : "%s %luul",
+                                     ( index > 0 ) ? "," : "",
+                                     compression->blocks[index] );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( "\n};\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( " = { ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fputs ( ", ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_blocks",
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 ", %luul, %luul, %luul, ",
+                                 compression->count,
+                                 arguments->blocksize,
+                                 compression->decoded );
+            success &= error >= 0;
+
+            if ( arguments->dictionary != NULL )
+            {
+                success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                        arguments->dictionary,
+                                                        arguments->suffix,
+                                                        outfile );
+            }
+            else
+            {
+                error =    fputs ( "NULL",
+                                   outfile );
+                success &= error >= 0;
+            }
+
+            error =    fprintf ( outfile,
+                                 ", %luul };\n",
+                                 arguments->dictsize );
+            success &= error >= 0;
+        }
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputchecksum function
+*
+*  This function outputs the macro of the CRC32C checksum of the input binary
+*  file's data, with the "-k" option's "crc32c:" item.
+*
+*  Parameter(s)
+*
+*  symbol:      pointer to the name of the array (usually the name of the input
+*               binary file, without the leading file path and without the
+*               trailing file extension)
+*  arguments:   pointer to the parameters of the command-line options
+*  compression: pointer to the description of the data
+*  outfile:     pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the macro
+*
+*  Remarks
+*
+*  The name is the full name of the array without the "-s" option's suffix,
+*  followed by "_crc32c", capitalized.  With the "-l" option, which keeps the
+*  header file independent of the input binary file's data, there is no macro,
+*  and the checksum is only a member of the "_crc" description.
+*/
+
+static bool main_runbin2c_outputchecksum
+(
+    char const * restrict             symbol,
+    main_arguments const * restrict   arguments,
+    main_compression const * restrict compression,
+    FILE * restrict                   outfile
+)
+{
+    bool            success;
+    char * restrict macro;
+
+    macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                             symbol,
+                                             "_crc32c" );
+    success = macro != NULL;
+
+    if ( success )
+    {
+        int error;
+
+        error =   fprintf ( outfile,
+                            "#define %s  0x%08lXul\n\n",
+                            macro,
+                            compression->checksum );
+        success = error >= 0;
+
+        free ( macro );
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputhashes function
+*
+*  This function outputs the declarations or definitions of the checksums of
+*  the input binary file's blocks and the "bin2c_crc_index" description of the
+*  checksums, with the "-k" option's "crc32c:" item.
+*
+*  Parameter(s)
+*
+*  symbol:       pointer to the name of the array (usually the name of the input
+*                binary file, without the leading file path and without the
+*                trailing file extension)
+*  arguments:    pointer to the parameters of the command-line options
+*  compression:  pointer to the description of the data
+*  size:         the number of bytes of the input binary file's data
+*  definition:   whether to output the definitions (as opposed to "extern"
+*                declarations, which only output header files with global scope
+*                need)
+*  outfile:      pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the declarations or definitions
+*
+*  Remarks
+*
+*  The names are the full name of the array without the "-s" option's suffix,
+*  followed by "_hashes" and "_crc", respectively.  The definitions take the
+*  same scope and form as the array's definition, like the block index's.  An
+*  empty input binary file has no blocks, but the checksums' array still has
+*  an element, given that C has no empty arrays.
+*/
+
+static bool main_runbin2c_outputhashes
+(
+    char const * restrict             symbol,
+    main_arguments const * restrict   arguments,
+    main_compression const * restrict compression,
+    unsigned long                     size,
+    bool                              definition,
+    FILE * restrict                   outfile
+)
+{
+    bool success;
+    bool external;
+    int  pass;
+
+    success =  true;
+    external = ( arguments->global != NULL ) || ( arguments->extent != NULL );
+
+    for ( pass = 0; success && ( pass < 2 ); pass += 1 )
+    {
+        int error;
+
+        if ( !definition )
+        {
+            error =    fputs ( "extern ",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( "\n",
+                               outfile );
+            success &= error >= 0;
+
+            if ( arguments->form == MAIN_FORM_INLINE )
+            {
+                success &= main_runbin2c_outputinline ( outfile );
+            }
+            else if ( !external )
+            {
+                error =    fputs ( "static ",
+                                   outfile );
+                success &= error >= 0;
+            }
+        }
+
+        error =    fputs ( ( pass == 0 ) ? "unsigned long const " : "bin2c_crc_index const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                ( pass == 0 ) ? "_hashes" : "_crc",
+                                                outfile );
+
+        if ( !definition )
+        {
+            error =    fputs ( ( pass == 0 ) ? "[];\n" : ";\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else if ( pass == 0 )
+        {
+            unsigned long index;
+
+            error =    fputs ( "[] =\n{",
+                               outfile );
+            success &= error >= 0;
+
+            for ( index = 0; success && ( index < compression->hashed ); index += 1u )
+            {
+                error =    fprintf ( outfile,
+                                     ( ( index % 8u ) == 0 ) ? "%s\n    0x%08lXul" : "%s 0x%08lXul",
+                                     ( index > 0 ) ? "," : "",
+                                     compression->hashes[index] );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( ( compression->hashed > 0 ) ? "\n};\n" : "\n    0ul\n};\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( " = { ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_hashes",
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 ", %luul, %luul, %luul, 0x%08lXul };\n",
+                                 compression->hashed,
+                                 arguments->hashsize,
+                                 size,
+                                 compression->checksum );
+            success &= error >= 0;
+        }
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_outputcached function
+*
+*  This function outputs the "_cached" function of the array, with the "-q"
+*  option, which returns the input binary file's decoded data from the cache.
+*
+*  Parameter(s)
+*
+*  symbol:      pointer to the name of the array (usually the name of the input
+*               binary file, without the leading file path and without the
+*               trailing file extension)
+*  arguments:   pointer to the parameters of the command-line options
+*  compression: pointer to the description of the compressed data
+*  length:      the number of elements of the array's data
+*  outfile:     pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the function
+*
+*  Remarks
+*
+*  The names are the full name of the array without the "-s" option's suffix,
+*  followed by "_decode" and "_cached".  The "_decode" function decodes the
+*  whole array (through the block index, with the "-k" option, and against the
+*  shared dictionary, with the "-d" option), which the cache calls on a miss.
+*  The key of the input binary file's entry is the full name of the array,
+*  whose hash (i.e.: its 32-bit FNV-1a hash) is a constant.  With the "-c auto"
+*  option, an array that holds the input binary file's data as is needs no
+*  cache, so its "_cached" function returns the array itself.
+*/
+
+static bool main_runbin2c_outputcached
+(
+    char const * restrict             symbol,
+    main_arguments const * restrict   arguments,
+    main_compression const * restrict compression,
+    long                              length,
+    FILE * restrict                   outfile
+)
+{
+    bool            success;
+    char * restrict key;
+    int             error;
+
+    key =     main_constructname ( arguments->prefix,
+                                   symbol,
+                                   arguments->suffix );
+    success = key != NULL;
+
+    if ( success && ( arguments->coding != MAIN_CODEC_NONE ) )
+    {
+        error =    fputs ( "\nBIN2C_CACHE_API size_t ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_decode",
+                                                outfile );
+
+        error =    fputs ( " ( unsigned char * dst, size_t dstsize )\n{\n    return ( ",
+                           outfile );
+        success &= error >= 0;
+
+        if ( compression->blocks != NULL )
+        {
+            error =    fputs ( "bin2c_lz_range ( &",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_blob",
+                                                    outfile );
+
+            error =    fputs ( ", 0, dstsize, dst, NULL ) );\n}\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( ( arguments->dictionary != NULL ) ? "bin2c_lz_decode_dict ( " : "bin2c_lz_decode ( ",
+                               outfile );
+            success &= error >= 0;
+
+            error =    fprintf ( outfile,
+                                 "%s, %luu, ",
+                                 key,
+                                 ( unsigned long ) length );
+            success &= error >= 0;
+
+            if ( arguments->dictionary != NULL )
+            {
+                success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                        arguments->dictionary,
+                                                        arguments->suffix,
+                                                        outfile );
+
+                error =    fprintf ( outfile,
+                                     ", %luu, ",
+                                     arguments->dictsize );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( "dst, dstsize ) );\n}\n",
+                               outfile );
+            success &= error >= 0;
+        }
+    }
+
+    if ( success )
+    {
+        error =    fputs ( "\nBIN2C_CACHE_API bin2c_cache_span ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_cached",
+                                                outfile );
+
+        error =    fputs ( " ( void )\n{\n    return ( ",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    if ( success && ( arguments->coding != MAIN_CODEC_NONE ) )
+    {
+        error =    fputs ( "bin2c_cache_get ( &",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->cache,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             ", \"%s\", 0x%08lXul, %luu, ",
+                             key,
+                             main_hashdata ( ( unsigned char const * ) key,
+                                             strlen ( key ) ),
+                     compression->decoded );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_decode",
+                                                outfile );
+    }
+    else if ( success )
+    {
+        error =    fprintf ( outfile,
+                             "bin2c_cache_wrap ( %s, %luu",
+                             key,
+                             ( unsigned long ) length );
+        success &= error >= 0;
+    }
+
+    if ( success )
+    {
+        error =    fputs ( " ) );\n}\n",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    if ( key != NULL )
+    {
+        free ( key );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_openarray function
+*
+*  This function creates the output C file that holds the definition of the
+*  array (or, with the "-j" option, of one shard of the array) and outputs
+*  everything that precedes the array's initializer values.
+*
+*  Parameter(s)
+*
+*  symbol:     pointer to the name of the array (usually the name of the input
+*              binary file, without the leading file path and without the
+*              trailing file extension)
+*  arguments:  pointer to the parameters of the command-line options
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*  offset:     index of the replaceable extension character in "outpath"
+*  shard:      index of the shard to create; must be zero without "-j"
+*  bound:      the number of elements the array states, with the "-h" option,
+*              as "main_runbin2c_measurebound" computes it
+*  compression: pointer to the description of the compressed data, with the
+*              "-c" option
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred and the output file, if it was created,
+*           likely is in an incomplete form
+*  !=NULL:  success; pointer to the "FILE" object for the output C file, which
+*           the caller must pass to "main_runbin2c_closearray"
+*
+*  Remarks
+*
+*  Shards are source files named after the input file with the shard's index
+*  and the ".c" extension (e.g.: "filename.0.c", "filename.1.c", etc.).  Each
+*  shard defines a static array in a section named after the full name of the
+*  array, aligned to "MAIN_SHARDALIGNMENT".  Given that every shard but the last
+*  is a multiple of that alignment in size, the linker lays out the shards
+*  contiguously, in the order in which the shards' object files are linked.
+*  With the "module" form of the "-m" option, the output file instead is a
+*  module interface unit with the ".cppm" extension, which names the module
+*  after the full name of the array and exports the array.
+*/
+
+static FILE * main_runbin2c_openarray
+(
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    char * restrict                 outpath,
+    size_t                          offset,
+    unsigned long                   shard,
+    unsigned long                   bound,
+    main_compression const *        compression
+)
+{
+    bool            success;
+    FILE * restrict outfile;
+    bool            external;
+
+    external = ( arguments->global != NULL ) || ( arguments->extent != NULL );
+
+    /*
+    ** The shards' pathnames need room for the index, so they are constructed
+    *  in a separate heap allocation, whereas the single output C file simply
+    *  reuses "outpath".
+    */
+
+    if ( arguments->shards != NULL )
+    {
+        char * restrict shardpath;
+
+        shardpath = ( char * ) malloc ( sizeof ( *shardpath ) * ( offset + ( sizeof ( shard ) * CHAR_BIT ) + 3u ) );
+        success =   shardpath != NULL;
+
+        if ( success )
+        {
+
+            memcpy ( shardpath,
+                     outpath,
+                     offset );
+            sprintf ( shardpath + offset,
+                      "%lu.c",
+                      shard );
+
+            outfile = fopen ( shardpath,
+                              "wt" );
+
+            free ( shardpath );
+
+        }
+        else
+        {
+            outfile = NULL;
+        }
+
+    }
+    else if ( arguments->form == MAIN_FORM_MODULE )
+    {
+        char * restrict modulepath;
+
+        modulepath = ( char * ) malloc ( sizeof ( *modulepath ) * ( offset + 5u ) );
+        success =    modulepath != NULL;
+
+        if ( success )
+        {
+
+            memcpy ( modulepath,
+                     outpath,
+                     offset );
+            strcpy ( modulepath + offset,
+                     "cppm" );
+
+            outfile = fopen ( modulepath,
+                              "wt" );
+
+            free ( modulepath );
+
+        }
+        else
+        {
+            outfile = NULL;
+        }
+
+    }
+    else
+    {
+
+        outpath[offset] = external ? 'c' : 'h';
+
+        outfile = fopen ( outpath,
+                          "wt" );
+
+    }
+
+    success = outfile != NULL;
+
+    /*
+    ** If the name has global scope, then the definition of the array must
+    *  reside in a source file.  Otherwise, the definition of the array must
+    *  reside in a header file and the name must have static scope.
+    *  Therefore, this function creates either a source or header file for
+    *  the array definition, based on the name's scope.  (Shards always have
+    *  static scope, given that only their sections' layout matters.)
+    */
+
+    if ( success )
+    {
+        int error;
+
+        if ( external )
+        {
+            error =    fprintf ( outfile,
+                                 "#include \"%s.h\"\n\n",
+                                 symbol );
+            success &= error >= 0;
+        }
+
+        if ( arguments->form == MAIN_FORM_INLINE )
+        {
+            success &= main_runbin2c_outputguard ( symbol,
+                                                   outfile );
+        }
+
+        /*
+        ** The global module fragment is where the module interface unit's
+        *  "#include" directives belong.  The size's type needs "<cstddef>".
+        */
+
+        if ( arguments->form == MAIN_FORM_MODULE )
+        {
+            error =    fputs ( "module;\n\n#include <cstddef>\n\nexport module ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fputs ( ";\n\nexport\n{\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+
+        if ( !external && arguments->automatic )
+        {
+            success &= main_runbin2c_outputcompressed ( symbol,
+                                                        arguments,
+                                                        false,
+                                                        outfile );
+        }
+
+        if ( !external && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) )
+        {
+            error =    fputs ( ( arguments->coding == MAIN_CODEC_DELTA ) ? "#include \"bin2c_delta.h\"\n\n" : "#include \"bin2c_lz.h\"\n\n",
+                               outfile );
+            success &= error >= 0;
+
+            if ( arguments->base != NULL )
+            {
+                error =    fprintf ( outfile,
+                                     "#include \"%s.h\"\n\n",
+                                     arguments->basename );
+                success &= error >= 0;
+            }
+
+            if ( arguments->dictionary != NULL )
+            {
+                error =    fprintf ( outfile,
+                                     "#include \"%s.h\"\n\n",
+                                     arguments->dictionary );
+                success &= error >= 0;
+            }
+
+            success &= main_runbin2c_outputdecoded ( symbol,
+                                                     arguments,
+                                                     compression,
+                                                     false,
+                                                     outfile );
+        }
+
+        if ( !external && ( arguments->hashsize > 0 ) )
+        {
+            error =    fputs ( "#include \"bin2c_crc.h\"\n\n",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputchecksum ( symbol,
+                                                      arguments,
+                                                      compression,
+                                                      outfile );
+        }
+
+        if ( arguments->cache != NULL )
+        {
+            error =    fprintf ( outfile,
+                                 "#include \"%s.h\"\n\n",
+                                 arguments->cache );
+            success &= error >= 0;
+        }
+
+        if ( arguments->reload != NULL )
+        {
+            success &= main_runbin2c_outputreload ( symbol,
+                                                    arguments,
+                                                    outfile );
+        }
+
+        if ( arguments->shards == NULL )
+        {
+            success &= main_runbin2c_outputplacement ( arguments,
+                                                       true,
+                                                       outfile );
+        }
+
+        if ( arguments->form == MAIN_FORM_INLINE )
+        {
+            success &= main_runbin2c_outputinline ( outfile );
+        }
+        else if ( arguments->form == MAIN_FORM_MODULE )
+        {
+            error =    fputs ( "inline constexpr ",
+                               outfile );
+            success &= error >= 0;
+        }
+        else if ( !external || ( arguments->shards != NULL ) )
+        {
+            error =    fputs ( "static ",
+                               outfile );
+            success &= error >= 0;
+        }
+
+        {
+            error =    fputs ( "unsigned char const ",
+                               outfile );
+            success &= error >= 0;
+        }
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->suffix,
+                                                outfile );
+
+        if ( arguments->shards != NULL )
+        {
+            unsigned long alignment;
+
+            alignment = MAIN_SHARDALIGNMENT;
+
+            if ( ( arguments->alignment != NULL ) && ( arguments->alignsize > alignment ) )
+            {
+                alignment = arguments->alignsize;
+            }
+
+            error =    fprintf ( outfile,
+                                 "_%lu[",
+                                 shard );
+            success &= error >= 0;
+
+            if ( arguments->holes != NULL )
+            {
+                error =    fprintf ( outfile,
+                                     "%lu",
+                                     bound );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( "] __attribute__ ( ( used, section ( \"bin2c_",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 "\" ), aligned ( %lu ) ) )",
+                                 alignment );
+            success &= error >= 0;
+
+        }
+        else if ( ( arguments->holes != NULL ) && ( bound > 0 ) )
+        {
+
+            error =    fprintf ( outfile,
+                                 "[%lu]",
+                                 bound );
+            success &= error >= 0;
+
+        }
+        else
+        {
+
+            error =    fputs ( "[]",
+                               outfile );
+            success &= error >= 0;
+
+        }
+
+        error =    fputs ( ( arguments->lines != NULL ) ? " =\n{\n" : " = { ",
+                           outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( !success && ( outfile != NULL ) )
+    {
+        fclose ( outfile );
+        outfile = NULL;
+    }
+
+    return ( outfile );
+}
+
+
+
+/*
+** main_runbin2c_removeshards function
+*
+*  This function removes the shards that a previous run with a smaller shard
+*  size (or a larger input binary file) left behind, after the last shard of
+*  this run, with the "-j" option.
+*
+*  Parameter(s)
+*
+*  symbol:   pointer to the name of the array (usually the name of the input
+*            binary file, without the leading file path and without the
+*            trailing file extension)
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*  offset:   index of the replaceable extension character in "outpath"
+*  shard:    index of the first shard that this run did not create
+*
+*  Return value(s)
+*
+*  ==false:  failure; a heap allocation failed or a leftover shard could not
+*            be removed
+*  !=false:  success; no leftover shard follows the last shard
+*
+*  Remarks
+*
+*  A build that compiles every shard that matches a pattern would otherwise
+*  link the leftover shards into the array's section as well.  The shards of a
+*  run are consecutive, so the removal stops at the first missing one.  Every
+*  removed shard is reported on the standard error pipe.
+*/
+
+static bool main_runbin2c_removeshards
+(
+    char const * restrict symbol,
+    char const * restrict outpath,
+    size_t                offset,
+    unsigned long         shard
+)
+{
+    bool            success;
+    char * restrict shardpath;
+
+    shardpath = ( char * ) malloc ( sizeof ( *shardpath ) * ( offset + ( sizeof ( shard ) * CHAR_BIT ) + 3u ) );
+    success =   shardpath != NULL;
+
+    if ( success )
+    {
+        memcpy ( shardpath,
+                 outpath,
+                 offset );
+
+        for ( ; ; shard += 1u )
+        {
+            FILE * restrict leftover;
+
+            sprintf ( shardpath + offset,
+                      "%lu.c",
+                      shard );
+
+            leftover = fopen ( shardpath,
+                               "rb" );
+
+            if ( leftover == NULL )
+            {
+                break;
+            }
+
+            fclose ( leftover );
+
+            success = remove ( shardpath ) == 0;
+
+            if ( !success )
+            {
+                fprintf ( stderr,
+                          "ERROR: failed to remove the leftover shard \"%s\" of \"%s\".",
+                          shardpath,
+                          symbol );
+                break;
+            }
+
+            ( void ) fprintf ( stderr,
+                               "%s: removed the leftover shard \"%s\"\n",
+                               symbol,
+                               shardpath );
+        }
+
+        free ( shardpath );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_closearray function
+*
+*  This function outputs everything that follows the array's initializer values
+*  and closes the output C file that "main_runbin2c_openarray" created.
+*
+*  Parameter(s)
+*
+*  symbol:     pointer to the name of the array (usually the name of the input
+*              binary file, without the leading file path and without the
+*              trailing file extension)
+*  arguments:  pointer to the parameters of the command-line options
+*  length:     number of elements in the whole array (i.e.: all shards)
+*  compression: pointer to the description of the compressed data, with the
+*              "-c" option
+*  last:       whether the output C file holds the last (or only) shard
+*  outfile:    pointer to the "FILE" object for the output C file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file is complete
+*
+*  Remarks
+*
+*  This function always closes the output C file, even upon failure.
+*/
+
+static bool main_runbin2c_closearray
+(
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    long                            length,
+    main_compression const *        compression,
+    bool                            last,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+    bool external;
+
+    external = ( arguments->global != NULL ) || ( arguments->extent != NULL );
+
+    {
+        int error;
+
+        error =   fputs ( ( arguments->lines != NULL ) ? "\n};\n" : " };\n",
+                          outfile );
+        success = error >= 0;
+
+        if ( last && !external && ( compression->blocks != NULL ) )
+        {
+            success &= main_runbin2c_outputblob ( symbol,
+                                                  arguments,
+                                                  compression,
+                                                  true,
+                                                  outfile );
+        }
+
+        if ( last && !external && ( arguments->hashsize > 0 ) )
+        {
+            success &= main_runbin2c_outputhashes ( symbol,
+                                                    arguments,
+                                                    compression,
+                                                    ( arguments->coding != MAIN_CODEC_NONE ) ? compression->decoded : ( unsigned long ) length,
+                                                    true,
+                                                    outfile );
+        }
+
+        if ( last && ( arguments->cache != NULL ) )
+        {
+            success &= main_runbin2c_outputcached ( symbol,
+                                                    arguments,
+                                                    compression,
+                                                    length,
+                                                    outfile );
+        }
+
+        /*
+        ** The "-z" option's padding counts towards "sizeof", so without the
+        *  "-g" and "-l" options' names, a macro keeps the data's size (the
+        *  "-r" option's macro and the "module" form's constant already do).
+        */
+
+        if ( last && !external && ( arguments->padding != NULL ) && ( arguments->reload == NULL ) && ( arguments->form != MAIN_FORM_MODULE ) )
+        {
+            char * restrict macro;
+
+            macro =    main_runbin2c_constructmacro ( arguments->prefix,
+                                                      symbol,
+                                                      "_size" );
+            success &= macro != NULL;
+
+            if ( macro != NULL )
+            {
+                error =    fprintf ( outfile,
+                                     "\n#define %s  %luul\n",
+                                     macro,
+                                     ( unsigned long ) length );
+                success &= error >= 0;
+
+                free ( macro );
+            }
+        }
+
+        if ( arguments->form == MAIN_FORM_INLINE )
+        {
+            error =    fputs ( "\n#endif\n",
+                               outfile );
+            success &= error >= 0;
+        }
+
+        /*
+        ** With the "-r" option, both of the header file's alternatives have a
+        *  size macro and a span, which the reloading one defines as well.
+        */
+
+        if ( arguments->reload != NULL )
+        {
+            error =    fputs ( "\n#define ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_size",
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 "  ( ( size_t ) %luu )\n\n#if defined ( __GNUC__ )\n__attribute__ ( ( unused ) )\n#endif\nstatic bin2c_reload_span const ",
+                                 ( unsigned long ) length );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_span",
+                                                    outfile );
+
+            error =    fputs ( " = { ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 ", %luu };\n\n#endif\n",
+                                 ( unsigned long ) length );
+            success &= error >= 0;
+        }
+
+        /*
+        ** A module exports no macros, so the size is a constant of its own.
+        *  Like the array, it is "inline", without which some compilers give
+        *  exported constants internal linkage (as outside of modules).
+        */
+
+        if ( arguments->form == MAIN_FORM_MODULE )
+        {
+            error =    fputs ( "\ninline constexpr std::size_t ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    "_size",
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 " = %luu;\n\n}\n",
+                                 ( unsigned long ) length );
+            success &= error >= 0;
+        }
+
+    }
+
+    /*
+    ** The "-l" and "-e" options' names are constants that the source file
+    *  defines, which is what keeps the values that depend on the input
+    *  binary file's data out of the header file.  With the "-j" option, the
+    *  last shard defines them, as only then is the length known.
+    */
+
+    if ( last && ( arguments->extent != NULL ) )
+    {
+        int error;
+
+        error =    fputs ( "\nsize_t const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->extent,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             " = %luul;\n",
+                             ( unsigned long ) length );
+        success &= error >= 0;
+
+    }
+
+    if ( last && ( arguments->end != NULL ) )
+    {
+        int error;
+
+        error =    fputs ( "\nunsigned char const * const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->end,
+                                                outfile );
+
+        error =    fputs ( " = ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             " + %luul;\n",
+                             ( unsigned long ) length );
+        success &= error >= 0;
+
+    }
+
+    if ( last && ( arguments->extent != NULL ) && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) )
+    {
+        success &= main_runbin2c_outputdecoded ( symbol,
+                                                 arguments,
+                                                 compression,
+                                                 true,
+                                                 outfile );
+    }
+
+    if ( last && ( arguments->extent != NULL ) && arguments->automatic )
+    {
+        success &= main_runbin2c_outputcompressed ( symbol,
+                                                    arguments,
+                                                    true,
+                                                    outfile );
+    }
+
+    if ( last && external && ( compression->blocks != NULL ) )
+    {
+        success &= main_runbin2c_outputblob ( symbol,
+                                              arguments,
+                                              compression,
+                                              true,
+                                              outfile );
+    }
+
+    if ( last && external && ( arguments->hashsize > 0 ) )
+    {
+        success &= main_runbin2c_outputhashes ( symbol,
+                                                arguments,
+                                                compression,
+                                                ( arguments->coding != MAIN_CODEC_NONE ) ? compression->decoded : ( unsigned long ) length,
+                                                true,
+                                                outfile );
+    }
+
+    {
+        int error;
+
+        error =    fflush ( outfile );
+        success &= error >= 0;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runbin2c_measurebound function
+*
+*  This function computes the number of elements that an array (i.e.: a shard,
+*  with the "-j" option) states between its brackets, with the "-h" option.
+*
+*  Parameter(s)
+*
+*  arguments:  pointer to the parameters of the command-line options
+*  total:      the number of bytes of the data
+*  shard:      index of the shard (zero, without the "-j" option)
+*
+*  Return value(s)
+*
+*  The number of elements, including the "-z" option's padding for the last
+*  array, which is zero only when that array is empty.
+*
+*  Remarks
+*
+*  An array that states its number of elements needs no initializer for its
+*  trailing elements, which static initialization sets to zero.  So, the "-h"
+*  option trims trailing zero bytes, and the padding never has initializers.
+*/
+
+static unsigned long main_runbin2c_measurebound
+(
+    main_arguments const * restrict arguments,
+    unsigned long                   total,
+    unsigned long                   shard
+)
+{
+    unsigned long bound;
+
+    bound = total;
+
+    if ( arguments->shards != NULL )
+    {
+        bound -= shard * arguments->shardsize;
+
+        if ( bound > arguments->shardsize )
+        {
+            return ( arguments->shardsize );
+        }
+    }
+
+    if ( arguments->padding != NULL )
+    {
+        bound += arguments->padsize;
+    }
+
+    return ( bound );
+}
+
+
+
+#if defined ( MAIN_SEEKDATA )
+
+/*
+** main_runbin2c_skiphole function
+*
+*  This function skips the hole, if any, at the current position of a sparse
+*  input binary file, with the "-h" option.
+*
+*  Parameter(s)
+*
+*  infile:  pointer to the "FILE" object for the input binary file
+*  total:   the number of bytes of the input binary file
+*  zeros:   pointer to the number of pending zero bytes, which grows by the size
+*           of the hole
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as the file position being lost
+*  !=false:  success; the input binary file is at the next data (or its end)
+*
+*  Remarks
+*
+*  A hole reads as zero bytes, but it occupies no storage, so skipping it saves
+*  reading (and scanning) what can be gigabytes of zeros in an image.  Systems
+*  that do not track holes report all of the file as data, while "ENXIO" means
+*  that only a hole remains.  The "lseek" function bypasses the "FILE" object's
+*  buffer, which the final "fseek" resynchronizes.
+*/
+
+static bool main_runbin2c_skiphole
+(
+    FILE * restrict          infile,
+    unsigned long            total,
+    unsigned long * restrict zeros
+)
+{
+    bool success;
+    long here;
+
+    here =    ftell ( infile );
+    success = here >= 0;
+
+    if ( success )
+    {
+        off_t data;
+
+        data = lseek ( fileno ( infile ),
+                       ( off_t ) here,
+                       SEEK_DATA );
+
+        if ( data < 0 )
+        {
+            data = ( errno == ENXIO ) ? ( off_t ) total : ( off_t ) here;
+        }
+
+        if ( data < ( off_t ) here )
+        {
+            data = ( off_t ) here;
+        }
+
+        if ( data > ( off_t ) total )
+        {
+            data = ( off_t ) total;
+        }
+
+        success = fseek ( infile,
+                          ( long ) data,
+                          SEEK_SET ) == 0;
+
+        *zeros += ( unsigned long ) ( data - ( off_t ) here );
+    }
+
+    return ( success );
+}
+
+#endif
+
+
+
+/*
+** main_runbin2c function
+*
+*  This is the core function of the program, which only the "main" function
+*  should call, after parsing and validating the command-line arguments.
+*
+*  Parameter(s)
+*
+*  infile:     pointer to the "FILE" object for the input binary file; must be
+*              be opened in "rb" or equivalent mode (but, idealy, not "r+b")
+*  symbol:     pointer to the name of the array (usually the name of the input
+*              binary file, without the leading file path and without the
+*              trailing file extension)
+*  arguments:  pointer to the parameters of the command-line options (e.g.: the
+*              prefix and suffix portions of the name of the array)
+*  outpath:    pointer to the pathname for the output files; a single-character
+*              extension must be present, which this function will replace with
+*              "h" and, potentially, "c", in the process of creating the array
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the array of binary data
+*
+*  Remarks
+*
+*  This function assumes that the caller, which should be "main", has already
+*  performed all necessary validation (e.g.: "binfile" is readable in binary
+*  form, "symbol" is a valid symbol name, etc.).  Deviations from this
+*  function's assumptions can result in incomplete data and/or an uncompilable
+*  header and/or source file.
+*/
+
+static bool main_runbin2c
+(
+    FILE * restrict                 infile,
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    char * restrict                 outpath
+)
+{
+    bool             success;
+    bool             external;
+    size_t           offset;
+    long             length;
+    FILE *           source;
+    main_compression compression;
+    main_arguments   settings;
+    unsigned long    entropy;
+
+    success =  true;
+    external = ( arguments->global != NULL ) || ( arguments->extent != NULL );
+    source =   infile;
+    entropy =  0;
+
+    compression.decoded =  0;
+    compression.encoded =  0;
+    compression.blocks =   NULL;
+    compression.count =    0;
+    compression.checksum = 0;
+    compression.hashes =   NULL;
+    compression.hashed =   0;
+
+    /*
+    ** The last character of "outpath" is the whitespace that this function
+    *  replaces with "h" and, potentially, "c" to create the C output files.
+    */
+
+    if ( success )
+    {
+        offset =  strlen ( outpath );
+        success = offset >= 1u;
+        offset -= 1u;
+    }
+
+    /*
+    ** The "crc32c:" item's checksums are of the input binary file's data, which
+    *  the compressor replaces, so they come first.
+    */
+
+    if ( success && ( arguments->hashsize > 0 ) )
+    {
+        success = main_runbin2c_digest ( infile,
+                                         arguments,
+                                         &compression );
+    }
+
+    /*
+    ** With the "-c auto" option, the rest of this function sees the codec that
+    *  suits the input binary file, as if the "-c" option had selected it.
+    */
+
+    if ( success && ( arguments->coding == MAIN_CODEC_AUTO ) )
+    {
+        settings =           *arguments;
+        settings.automatic = true;
+
+        success =   main_runbin2c_choose ( infile,
+                                           symbol,
+                                           arguments,
+                                           &settings.coding,
+                                           &entropy );
+        arguments = &settings;
+    }
+
+    /*
+    ** With the "-c" option, the array holds the compressed data instead of the
+    *  input binary file's data, and the decoder's support header file must be
+    *  present next to the output C file(s).
+    */
+
+    if ( success && ( arguments->coding != MAIN_CODEC_NONE ) )
+    {
+        source =  main_runbin2c_compress ( infile,
+                                           arguments,
+                                           &compression );
+        success = source != NULL;
+    }
+
+    /*
+    ** A decision of the "-c auto" option to compress stands only if the
+    *  compressed data is actually smaller than the input binary file's data.
+    */
+
+    if ( success && ( arguments == &settings ) && ( settings.coding != MAIN_CODEC_NONE ) )
+    {
+        if ( compression.encoded < compression.decoded )
+        {
+            ( void ) fprintf ( stderr,
+                               "%s: compressed from %lu bytes to %lu, with an entropy of %lu.%02lu bits per byte\n",
+                               symbol,
+                               compression.decoded,
+                               compression.encoded,
+                               entropy / 100u,
+                               entropy % 100u );
+        }
+        else
+        {
+            ( void ) fprintf ( stderr,
+                               "%s: stored, because compressing its %lu bytes yields %lu\n",
+                               symbol,
+                               compression.decoded,
+                               compression.encoded );
+
+            fclose ( source );
+            source = infile;
+
+            if ( compression.blocks != NULL )
+            {
+                free ( compression.blocks );
+            }
+
+            compression.encoded = 0;
+            compression.blocks =  NULL;
+            compression.count =   0;
+            settings.coding =     MAIN_CODEC_NONE;
+
+            rewind ( infile );
+        }
+    }
+
+    /*
+    ** An array that the "-c auto" option stores has a decoded size as well (its
+    *  own size), so that the header file does not depend on the decision.
+    */
+
+    if ( success && arguments->automatic && ( arguments->coding == MAIN_CODEC_NONE ) )
+    {
+        long end;
+
+        success = fseek ( infile,
+                          0l,
+                          SEEK_END ) == 0;
+        end =     success ? ftell ( infile ) : -1l;
+        success = end >= 0;
+
+        if ( success )
+        {
+            compression.decoded = ( unsigned long ) end;
+        }
+
+        rewind ( infile );
+    }
+
+    if ( success && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) )
+    {
+        if ( arguments->coding == MAIN_CODEC_DELTA )
+        {
+            success = main_runbin2c_outputpatcher ( outpath );
+        }
+        else
+        {
+            success = main_runbin2c_outputdecoder ( outpath );
+        }
+    }
+
+    if ( success && ( arguments->hashsize > 0 ) )
+    {
+        success = main_runbin2c_outputhasher ( outpath );
+    }
+
+    if ( success && ( arguments->reload != NULL ) )
+    {
+        success = main_runbin2c_outputreloader ( outpath );
+    }
+
+    /*
+    ** In the context of this converter, the purpose of naming the array is to
+    *  avoid name collision.  Hence, the name has the option to have a prefix
+    *  and suffix.  That means names such as "g_filename_data" are possible.
+    *  (The "filename" portion is the input binary file name, excluding the path
+    *  and extension, which leverages any name anti-collision happening among
+    *  the source files in a project).
+    */
+
+    {
+        FILE * restrict outfile;
+        unsigned long   shard;
+        unsigned long   total;
+
+        outfile = NULL;
+        shard =   0;
+        total =   0;
+
+        /*
+        ** With the "-h" option, every array states its number of elements,
+        *  so the size of the data must be known before the first array.
+        */
+
+        if ( success && ( arguments->holes != NULL ) )
+        {
+            long end;
+
+            success = fseek ( source,
+                              0l,
+                              SEEK_END ) == 0;
+            end =     success ? ftell ( source ) : -1l;
+            success = end >= 0;
+
+            if ( success )
+            {
+                total =    ( unsigned long ) end;
+                success &= arguments->padsize <= ( ULONG_MAX - total );
+            }
+
+            rewind ( source );
+        }
+
+        if ( success )
+        {
+            outfile = main_runbin2c_openarray ( symbol,
+                                                arguments,
+                                                outpath,
+                                                offset,
+                                                shard,
+                                                main_runbin2c_measurebound ( arguments,
+                                                                             total,
+                                                                             shard ),
+                                                &compression );
+            success = outfile != NULL;
+        }
+
+        /*
+        ** This converter attempts to efficiently read from the input binary file in
+        *  large chunks that are potentially multiples of the page size.  This
+        *  approach facilitates some file systems' caching behavior that auto-
+        *  selects unbuffered reads, which, importantly, amortizes time lost to
+        *  media access and can eliminate in-memory copying. (Therefore, using the
+        *  "r+b" mode is not ideal as the potential for writing may prevent
+        *  unbuffered reading.)   Conversely, this converter attempts to efficiently
+        *  write to the output C file in small chunks in an attempt to induce the
+        *  file systems' caching to use buffered writes which, importantly, means
+        *  flushing to stable media in the background.  (Therefore, using the "w+t"
+        *  mode is not ideal as it may delay including pages in flushes.)
+        */
+
+        {
+            static unsigned char const zeroes[MAIN_CHUNKSIZE / MAIN_ENCODEDSIZE] = { 0 };
+
+            unsigned char * restrict buffer;
+            char * restrict          text;
+            unsigned long            remaining;
+            unsigned long            position;
+            unsigned long            zeros;
+            bool                     designated;
+
+            CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+            CHECK ( ( SIZE_MAX / sizeof ( *text ) ) >= MAIN_CHUNKSIZE );
+            CHECK ( MAIN_CHUNKSIZE >= MAIN_ENCODEDSIZE );
+            CHECK ( ULONG_MAX >= LONG_MAX );
+
+            length =     0;
+            position =   0;
+            zeros =      0;
+            designated = false;
+
+            /*
+            ** Without the "-j" option, the single array never runs out of room,
+            *  given that the length of the array cannot exceed "LONG_MAX".
+            */
+
+            if ( arguments->shards != NULL )
+            {
+                remaining = arguments->shardsize;
+            }
+            else
+            {
+                remaining = ULONG_MAX;
+            }
+
+            buffer =   ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+            success &= buffer != NULL;
+
+            text =     ( char * ) malloc ( sizeof ( *text ) * MAIN_CHUNKSIZE );
+            success &= text != NULL;
+
+            while ( success )
+            {
+                size_t count;
+                bool   ending;
+
+#if defined ( MAIN_SEEKDATA )
+
+                if ( ( arguments->holes != NULL ) && ( source == infile ) )
+                {
+                    success = main_runbin2c_skiphole ( source,
+                                                       total,
+                                                       &zeros );
+                }
+
+#endif
+
+                count = fread ( buffer,
+                                sizeof ( *buffer ),
+                                MAIN_CHUNKSIZE,
+                                source );
+                if ( count < 1u )
+                {
+                    if ( ferror ( source ) )
+                    {
+                        success = false;
+                    }
+                }
+
+                ending = feof ( source ) != 0;
+
+                if ( success )
+                {
+                    unsigned char const * data;
+
+                    data = buffer;
+
+                    while ( success && ( ( count > 0 ) || ( ending && ( zeros > 0 ) ) ) )
+                    {
+                        unsigned char const * from;
+                        size_t                run;
+                        size_t                size;
+
+                        /*
+                        ** With the "-h" option, zero bytes join the pending
+                        *  zeros, which wait for the next non-zero byte (or the
+                        *  end of the data) to decide whether they are a hole.
+                        */
+
+                        if ( ( arguments->holes != NULL ) && ( count > 0 ) )
+                        {
+                            run =   main_runbin2c_measurerun ( data,
+                                                               count,
+                                                               0 );
+                            zeros += ( unsigned long ) run;
+                            count -= run;
+                            data +=  run;
+
+                            if ( ( count < 1u ) && !ending )
+                            {
+                                break;
+                            }
+                        }
+
+                        /*
+                        ** A full shard gets closed and the next one opened only
+                        *  when there is another byte to place, so that there
+                        *  never is an empty trailing shard.
+                        */
+
+                        if ( remaining < 1u )
+                        {
+
+                            success = main_runbin2c_closearray ( symbol,
+                                                                 arguments,
+                                                                 length,
+                                                                 &compression,
+                                                                 false,
+                                                                 outfile );
+                            outfile = NULL;
+                            shard +=  1u;
+
+                            if ( success )
+                            {
+                                outfile = main_runbin2c_openarray ( symbol,
+                                                                    arguments,
+                                                                    outpath,
+                                                                    offset,
+                                                                    shard,
+                                                                    main_runbin2c_measurebound ( arguments,
+                                                                                                 total,
+                                                                                                 shard ),
+                                                                    &compression );
+                                success = outfile != NULL;
+                            }
+
+                            remaining =  arguments->shardsize;
+                            position =   0;
+                            designated = false;
+
+                            if ( !success )
+                            {
+                                break;
+                            }
+
+                        }
+
+                        /*
+                        ** Pending zeros are a hole when there are enough of them
+                        *  or when they reach the end of the array (which then
+                        *  trims them), except that every array keeps its first
+                        *  element, so that an initializer is never empty.  A
+                        *  hole only advances the position, after which the next
+                        *  element designates its index.
+                        */
+
+                        if ( zeros > 0 )
+                        {
+                            unsigned long piece;
+
+                            piece = ( zeros < remaining ) ? zeros : remaining;
+
+                            if ( ( position > 0 ) && ( ( piece >= arguments->holesize ) || ( piece == remaining ) || ( ending && ( count < 1u ) ) ) )
+                            {
+                                success &= ( unsigned long ) ( LONG_MAX - length ) >= piece;
+
+                                length +=    ( long ) piece;
+                                position +=  piece;
+                                remaining -= piece;
+                                zeros -=     piece;
+                                designated = true;
+
+                                continue;
+                            }
+
+                            from = zeroes;
+                            run =  ( position > 0 ) ? ( sizeof ( zeroes ) - 1u ) : 1u;
+
+                            if ( run > zeros )
+                            {
+                                run = ( size_t ) zeros;
+                            }
+                        }
+                        else
+                        {
+                            from = data;
+                            run =  MAIN_CHUNKSIZE / MAIN_ENCODEDSIZE - 1u;
+
+                            if ( run > count )
+                            {
+                                run = count;
+                            }
+
+                            /*
+                            ** With the "-h" option, a run of data stops at the
+                            *  next zero byte, which may start a hole.
+                            */
+
+                            if ( arguments->holes != NULL )
+                            {
+                                unsigned char const * zero;
+
+                                zero = ( unsigned char const * ) memchr ( data,
+                                                                          0,
+                                                                          run );
+
+                                if ( zero != NULL )
+                                {
+                                    run = ( size_t ) ( zero - data );
+                                }
+                            }
+                        }
+
+                        /*
+                        ** The encoder converts as much of the chunk as fits in
+                        *  both the current array and the text buffer at once,
+                        *  and that text is written with a single call.  (The
+                        *  room for one element is left for a designator.)
+                        */
+
+                        if ( run > remaining )
+                        {
+                            run = ( size_t ) remaining;
+                        }
+
+                        success &= ( unsigned long ) ( LONG_MAX - length ) >= run;
+
+                        size =     main_runbin2c_encode ( from,
+                                                          run,
+                                                          position,
+                                                          ( unsigned long ) length,
+                                                          designated,
+                                                          arguments,
+                                                          text );
+                        success &= fwrite ( text,
+                                            sizeof ( *text ),
+                                            size,
+                                            outfile ) == size;
+
+                        designated = false;
+                        length +=    ( long ) run;
+                        position +=  run;
+                        remaining -= run;
+
+                        if ( from == zeroes )
+                        {
+                            zeros -= run;
+                        }
+                        else
+                        {
+                            count -= run;
+                            data +=  run;
+                        }
+
+                    }
+
+                }
+
+                if ( ending )
+                {
+                    break;
+                }
+
+            }
+
+            /*
+            ** The padding of the "-z" option follows the data in the same
+            *  array (i.e.: the last shard, with the "-j" option), but does not
+            *  count towards the length.  The encoder converts it like any other
+            *  zero bytes, unless the "-h" option's bound already includes it.
+            */
+
+            if ( success && ( arguments->padding != NULL ) && ( arguments->holes == NULL ) )
+            {
+                unsigned long padding;
+                unsigned long pad;
+
+                memset ( buffer,
+                         0,
+                         sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+
+                padding = arguments->padsize;
+                pad =     ( unsigned long ) length;
+
+                while ( success && ( padding > 0 ) )
+                {
+                    size_t run;
+                    size_t size;
+
+                    run = MAIN_CHUNKSIZE / MAIN_ENCODEDSIZE;
+
+                    if ( run > padding )
+                    {
+                        run = ( size_t ) padding;
+                    }
+
+                    size =     main_runbin2c_encode ( buffer,
+                                                      run,
+                                                      position,
+                                                      pad,
+                                                      false,
+                                                      arguments,
+                                                      text );
+                    success &= fwrite ( text,
+                                        sizeof ( *text ),
+                                        size,
+                                        outfile ) == size;
+
+                    position += run;
+                    pad +=      run;
+                    padding -=  run;
+
+                }
+
+            }
+
+            if  ( text != NULL )
+            {
+                free ( text );
+            }
+
+            if  ( buffer != NULL )
+            {
+                free ( buffer );
+            }
+
+        }
+
+        if ( outfile != NULL )
+        {
+            success &= main_runbin2c_closearray ( symbol,
+                                                  arguments,
+                                                  length,
+                                                  &compression,
+                                                  true,
+                                                  outfile );
+        }
+
+        if ( success && ( arguments->shards != NULL ) )
+        {
+            success = main_runbin2c_removeshards ( symbol,
+                                                   outpath,
+                                                   offset,
+                                                   shard + 1u );
+        }
+
+    }
+
+    /*
+    ** If the name has global scope, then its definition resides in a source
+    *  file and its declaration resides in a header file.  (For static scope,
+    *  the definition resides in a header file and also serves as the name
+    *  declaration.)  Additionally, global scope obscures the array's size.
+    *  Therefore, the header file also has either a macro or an "extern"
+    *  constant that expresses the number of elements in the array.  The header
+    *  file is staged in a temporary file so that an unchanged header file keeps
+    *  its modification time.
+    */
+
+    if ( external )
+    {
+        FILE * restrict outfile;
+
+        outfile = NULL;
+
+        if ( success )
+        {
+
+            outpath[offset] = 'h';
+
+            outfile = tmpfile ( );
+            success = outfile != NULL;
+
+        }
+
+        if ( success )
+        {
+
+            success = main_runbin2c_outputguard ( symbol,
+                                                  outfile );
+
+            if ( success && ( arguments->extent != NULL ) )
+            {
+                int error;
+
+                error =   fputs ( "#include <stddef.h>\n\n",
+                                  outfile );
+                success = error >= 0;
+
+            }
+
+            if ( success && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) )
+            {
+                int error;
+
+                error =   fputs ( ( arguments->coding == MAIN_CODEC_DELTA ) ? "#include \"bin2c_delta.h\"\n\n" : "#include \"bin2c_lz.h\"\n\n",
+                                  outfile );
+                success = error >= 0;
+
+            }
+
+            if ( success && ( arguments->base != NULL ) )
+            {
+                int error;
+
+                error =   fprintf ( outfile,
+                                    "#include \"%s.h\"\n\n",
+                                    arguments->basename );
+                success = error >= 0;
+
+            }
+
+            if ( success && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) && ( arguments->dictionary != NULL ) )
+            {
+                int error;
+
+                error =   fprintf ( outfile,
+                                    "#include \"%s.h\"\n\n",
+                                    arguments->dictionary );
+                success = error >= 0;
+
+            }
+
+            if ( success && ( arguments->hashsize > 0 ) )
+            {
+                int error;
+
+                error =   fputs ( "#include \"bin2c_crc.h\"\n\n",
+                                  outfile );
+                success = error >= 0;
+
+            }
+
+        }
+
+        if ( success )
+        {
+
+            if ( arguments->shards != NULL )
+            {
+                int error;
+
+                error =    fputs ( "#if !defined ( __ELF__ )\n#error \"the array's shards require an ELF linker\"\n#endif\n\n",
+                                   outfile );
+                success &= error >= 0;
+
+            }
+
+            success &= main_runbin2c_outputplacement ( arguments,
+                                                       false,
+                                                       outfile );
+
+            {
+                int error;
+
+                error =    fputs ( "extern unsigned char const ",
+                                   outfile );
+                success &= error >= 0;
+
+            }
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            /*
+            ** The shards have static scope, so the name of the whole array
+            *  refers to the start of the shards' section instead, which the
+            *  linker provides for sections that have valid C names.
+            */
+
+            if ( arguments->shards != NULL )
+            {
+                int error;
+
+                error =    fputs ( "[] __asm__ ( \"__start_bin2c_",
+                                   outfile );
+                success &= error >= 0;
+
+                success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                        symbol,
+                                                        arguments->suffix,
+                                                        outfile );
+
+                error =    fputs ( "\" );\n\n",
+                                   outfile );
+                success &= error >= 0;
+
+            }
+            else
+            {
+                int error;
+
+                error =    fputs ( "[];\n\n",
+                                   outfile );
+                success &= error >= 0;
+
+            }
+
+        }
+
+        if ( success && ( arguments->global != NULL ) )
+        {
+
+            {
+                char * restrict macro;
+
+                macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                         symbol,
+                                                         arguments->global );
+                success = macro != NULL;
+
+                if ( success )
+                {
+                    int error;
+
+                    error =   fprintf ( outfile,
+                                        "#define %s",
+                                        macro );
+                    success = error >= 0;
+
+                    free ( macro );
+
+                }
+
+            }
+
+            if ( success )
+            {
+                int error;
+
+                #if defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l )
+                if ( length <= SCHAR_MAX )
+                {
+                    error = fprintf ( outfile,
+                                      "  %hhd",
+                                      ( signed char ) length );
+                }
+                else if ( length <= SHRT_MAX )
+                #else
+                if ( length <= SHRT_MAX )
+                #endif
+                {
+                    error = fprintf ( outfile,
+                                      "  %hd",
+                                      ( short ) length );
+                }
+                else if ( length <= INT_MAX )
+                {
+                    error = fprintf ( outfile,
+                                      "  %d",
+                                      ( int ) length );
+                }
+                else
+                {
+                    error = fprintf ( outfile,
+                                      "  %ldl",
+                                      length );
+                }
+
+                success &= error >= 0;
+
+                error =    fputs ( "\n\n",
+                                   outfile );
+                success &= error >= 0;
+
+            }
+
+        }
+
+        if ( success && ( arguments->extent != NULL ) )
+        {
+            int error;
+
+            error =    fputs ( "extern size_t const ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->extent,
+                                                    outfile );
+
+            error =    fputs ( ";\n\n",
+                               outfile );
+            success &= error >= 0;
+
+        }
+
+        if ( success && ( arguments->end != NULL ) )
+        {
+            int error;
+
+            error =    fputs ( "extern unsigned char const * const ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    symbol,
+                                                    arguments->end,
+                                                    outfile );
+
+            error =    fputs ( ";\n\n",
+                               outfile );
+            success &= error >= 0;
+
+        }
+
+        if ( success && arguments->automatic )
+        {
+            success = main_runbin2c_outputcompressed ( symbol,
+                                                       arguments,
+                                                       false,
+                                                       outfile );
+        }
+
+        if ( success && ( ( arguments->coding != MAIN_CODEC_NONE ) || arguments->automatic ) )
+        {
+            success = main_runbin2c_outputdecoded ( symbol,
+                                                    arguments,
+                                                    &compression,
+                                                    false,
+                                                    outfile );
+        }
+
+        if ( success && ( compression.blocks != NULL ) )
+        {
+            success = main_runbin2c_outputblob ( symbol,
+                                                 arguments,
+                                                 &compression,
+                                                 false,
+                                                 outfile );
+        }
+
+        if ( success && ( arguments->hashsize > 0 ) && ( arguments->global != NULL ) )
+        {
+            success = main_runbin2c_outputchecksum ( symbol,
+                                                     arguments,
+                                                     &compression,
+                                                     outfile );
+        }
+
+        if ( success && ( arguments->hashsize > 0 ) )
+        {
+            success = main_runbin2c_outputhashes ( symbol,
+                                                   arguments,
+                                                   &compression,
+                                                   0,
+                                                   false,
+                                                   outfile );
+        }
+
+        if ( success )
+        {
+            int error;
+
+            error =   fputs ( "#endif\n",
+                              outfile );
+            success = error >= 0;
+
+        }
+
+        if ( success )
+        {
+            int error;
+
+            error =   fflush ( outfile );
+            success = error >= 0;
+
+        }
+
+        if ( success )
+        {
+            success = main_runbin2c_commitfile ( outfile,
+                                                 outpath );
+        }
+
+        if ( outfile != NULL )
+        {
+            int error;
+
+            error =    fclose ( outfile );
+            success &= error >= 0;
+
+        }
+
+    }
+
+    if ( ( source != NULL ) && ( source != infile ) )
+    {
+        fclose ( source );
+    }
+
+    if ( compression.blocks != NULL )
+    {
+        free ( compression.blocks );
+    }
+
+    if ( compression.hashes != NULL )
+    {
+        free ( compression.hashes );
+    }
+
+    if ( !success )
+    {
+        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_traindictionary_hash function
+*
+*  This function hashes the eight bytes at the given position, for counting the
+*  input binary files that have the same eight bytes.
+*
+*  Parameter(s)
+*
+*  data:  pointer to the eight bytes to hash
+*
+*  Return value(s)
+*
+*  The hash, which is less than "1 << MAIN_LZTRAINBITS".
+*/
+
+static unsigned long main_traindictionary_hash
+(
+    unsigned char const * restrict data
+)
+{
+    unsigned long low;
+    unsigned long high;
+
+    low =   ( unsigned long ) data[0];
+    low |=  ( unsigned long ) data[1] << 8;
+    low |=  ( unsigned long ) data[2] << 16;
+    low |=  ( unsigned long ) data[3] << 24;
+    high =  ( unsigned long ) data[4];
+    high |= ( unsigned long ) data[5] << 8;
+    high |= ( unsigned long ) data[6] << 16;
+    high |= ( unsigned long ) data[7] << 24;
+
+    low = ( ( low * 2654435761ul ) ^ ( high * 2246822519ul ) ) & 0xFFFFFFFFul;
+    low = ( low * 2654435761ul ) & 0xFFFFFFFFul;
+
+    return ( low >> ( 32u - MAIN_LZTRAINBITS ) );
+}
+
+
+
+/*
+** main_traindictionary function
+*
+*  This function trains the shared dictionary of the "-d" option on the input
+*  binary files, by choosing the segments of their data that the most input
+*  binary files have in common.
+*
+*  Parameter(s)
+*
+*  inpaths:   pointer to the pathnames of the input binary files
+*  incount:   number of input binary files
+*  capacity:  the maximum size of the dictionary in bytes
+*  size:      pointer to the variable that receives the size of the dictionary
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as an input binary file not being
+*           readable or a heap allocation failing
+*  !=NULL:  success; pointer to the dictionary (the caller must release this
+*           heap allocation)
+*
+*  Remarks
+*
+*  The training follows the idea of the "cover" algorithm: the first
+*  "MAIN_LZSAMPLE" bytes of every input binary file form a corpus, in which
+*  every group of eight bytes scores the number of input binary files that have
+*  it (or zero, if only one does).  The corpus is split into as many epochs as
+*  the dictionary has segments of "MAIN_LZSEGMENT" bytes and the highest-scoring
+*  segment of each epoch joins the dictionary, after which its groups score
+*  zero, so that no other segment repeats them.  The segments fill the
+*  dictionary from its end, given that the end is closest to the data.
+*/
+
+static unsigned char * restrict main_traindictionary
+(
+    char * const * restrict  inpaths,
+    int                      incount,
+    unsigned long            capacity,
+    unsigned long * restrict size
+)
+{
+    bool                     success;
+    unsigned char * restrict corpus;
+    unsigned char * restrict dictionary;
+    unsigned long * restrict scores;
+    unsigned long * restrict owners;
+    size_t                   total;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *corpus ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( MAIN_LZSEGMENT > 8u );
+
+    corpus =     NULL;
+    dictionary = NULL;
+    scores =     NULL;
+    owners =     NULL;
+    total =      0;
+    *size =      0;
+
+    success =  capacity <= ( SIZE_MAX / sizeof ( *dictionary ) );
+    success &= ( 1ul << MAIN_LZTRAINBITS ) <= ( SIZE_MAX / sizeof ( *scores ) );
+
+    if ( success )
+    {
+        dictionary = ( unsigned char * ) malloc ( sizeof ( *dictionary ) * ( ( size_t ) capacity + 1u ) );
+        success =    dictionary != NULL;
+
+        scores =     ( unsigned long * ) calloc ( ( size_t ) 1u << MAIN_LZTRAINBITS,
+                                                  sizeof ( *scores ) );
+        success &=   scores != NULL;
+
+        owners =     ( unsigned long * ) calloc ( ( size_t ) 1u << MAIN_LZTRAINBITS,
+                                                  sizeof ( *owners ) );
+        success &=   owners != NULL;
+    }
+
+    /*
+    ** The corpus accumulates in a heap allocation that doubles in capacity
+    *  whenever it is full.  Each group of eight bytes counts once per input
+    *  binary file, which is what the owners (i.e.: the index of the last input
+    *  binary file to count it, plus one) keep track of.
+    */
+
+    {
+        size_t allocated;
+        int    input;
+
+        allocated = 0;
+
+        for ( input = 0; success && ( input < incount ); input += 1 )
+        {
+            FILE * restrict infile;
+            size_t          first;
+
+            infile =  fopen ( inpaths[input],
+                              "rb" );
+            success = infile != NULL;
+            first =   total;
+
+            while ( success && ( ( total - first ) < MAIN_LZSAMPLE ) )
+            {
+                size_t count;
+
+                if ( total == allocated )
+                {
+                    unsigned char * restrict larger;
+
+                    success =   allocated <= ( ( SIZE_MAX / sizeof ( *corpus ) ) / 2u );
+                    allocated = ( allocated > 0 ) ? ( allocated * 2u ) : MAIN_CHUNKSIZE;
+
+                    larger =  success ? ( unsigned char * ) realloc ( corpus,
+                                                                      sizeof ( *corpus ) * allocated ) : NULL;
+                    success = larger != NULL;
+
+                    if ( success )
+                    {
+                        corpus = larger;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                count = allocated - total;
+
+                if ( count > ( MAIN_LZSAMPLE - ( total - first ) ) )
+                {
+                    count = MAIN_LZSAMPLE - ( total - first );
+                }
+
+                count =  fread ( corpus + total,
+                                 sizeof ( *corpus ),
+                                 count,
+                                 infile );
+                total += count;
+
+                if ( ferror ( infile ) )
+                {
+                    success = false;
+                }
+
+                if ( feof ( infile ) )
+                {
+                    break;
+                }
+            }
+
+            if ( infile != NULL )
+            {
+                fclose ( infile );
+            }
+
+            if ( success && ( ( total - first ) >= 8u ) )
+            {
+                size_t position;
+
+                for ( position = first; ( position + 8u ) <= total; position += 1u )
+                {
+                    unsigned long hash;
+
+                    hash = main_traindictionary_hash ( corpus + position );
+
+                    if ( owners[hash] != ( unsigned long ) input + 1u )
+                    {
+                        owners[hash] =  ( unsigned long ) input + 1u;
+                        scores[hash] += 1u;
+                    }
+                }
+            }
+        }
+
+    }
+
+    if ( success )
+    {
+        unsigned long hash;
+
+        for ( hash = 0; hash < ( 1ul << MAIN_LZTRAINBITS ); hash += 1u )
+        {
+            if ( scores[hash] < 2u )
+            {
+                scores[hash] = 0;
+            }
+        }
+    }
+
+    /*
+    ** The score of a segment is the sum of the scores of the groups that
+    *  start in it, which slides along the epoch one position at a time.
+    */
+
+    if ( success && ( total >= MAIN_LZSEGMENT ) && ( capacity >= MAIN_LZSEGMENT ) )
+    {
+        size_t epoch;
+        size_t begin;
+        size_t tail;
+
+        epoch = total / ( capacity / MAIN_LZSEGMENT );
+
+        if ( epoch < MAIN_LZSEGMENT )
+        {
+            epoch = MAIN_LZSEGMENT;
+        }
+
+        tail = ( size_t ) capacity;
+
+        for ( begin = 0; ( ( begin + MAIN_LZSEGMENT ) <= total ) && ( tail >= MAIN_LZSEGMENT ); begin += epoch )
+        {
+            size_t        end;
+            size_t        position;
+            size_t        best;
+            unsigned long score;
+            unsigned long highest;
+
+            end = ( ( total - begin ) > epoch ) ? ( begin + epoch ) : total;
+
+            if ( ( end - begin ) < MAIN_LZSEGMENT )
+            {
+                end = begin + MAIN_LZSEGMENT;
+            }
+
+            score = 0;
+
+            for ( position = begin; position <= ( begin + MAIN_LZSEGMENT - 8u ); position += 1u )
+            {
+                score += scores[main_traindictionary_hash ( corpus + position )];
+            }
+
+            best =    begin;
+            highest = score;
+
+            for ( position = begin + 1u; ( position + MAIN_LZSEGMENT ) <= end; position += 1u )
+            {
+                score -= scores[main_traindictionary_hash ( corpus + position - 1u )];
+                score += scores[main_traindictionary_hash ( corpus + position + MAIN_LZSEGMENT - 8u )];
+
+                if ( score > highest )
+                {
+                    best =    position;
+                    highest = score;
+                }
+            }
+
+            if ( highest > 0 )
+            {
+                tail -= MAIN_LZSEGMENT;
+
+                memcpy ( dictionary + tail,
+                         corpus + best,
+                         MAIN_LZSEGMENT );
+
+                for ( position = best; position <= ( best + MAIN_LZSEGMENT - 8u ); position += 1u )
+                {
+                    scores[main_traindictionary_hash ( corpus + position )] = 0;
+                }
+            }
+        }
+
+        *size = ( unsigned long ) ( capacity - tail );
+
+        memmove ( dictionary,
+                  dictionary + tail,
+                  *size );
+    }
+
+    if ( owners != NULL )
+    {
+        free ( owners );
+    }
+
+    if ( scores != NULL )
+    {
+        free ( scores );
+    }
+
+    if ( corpus != NULL )
+    {
+        free ( corpus );
+    }
+
+    if ( !success && ( dictionary != NULL ) )
+    {
+        free ( dictionary );
+        dictionary = NULL;
+    }
+
+    return ( dictionary );
+}
+
+
+
+/*
+** main_dedupinputs_cut function
+*
+*  This function finds the end of the chunk that starts at the given data of an
+*  input binary file, with content-defined chunking.
+*
+*  Parameter(s)
+*
+*  data:  pointer to the data that the chunk starts
+*  size:  number of bytes of the input binary file from there on
+*  gear:  pointer to the 256 random values of the gear hash
+*
+*  Return value(s)
+*
+*  The size of the chunk, which is from "MAIN_DEDUPMINIMUM" to
+*  "MAIN_DEDUPMAXIMUM" bytes, unless fewer bytes remain.
+*
+*  Remarks
+*
+*  The gear hash shifts every byte's value out after 32 more bytes, so it only
+*  depends on the last 32 bytes, and a chunk ends wherever the top
+*  "MAIN_DEDUPBITS" bits of the hash are zero.  Given that the ends depend on
+*  the data rather than on its position, inserting or removing data only
+*  changes the chunks around it, whereas the others still match.
+*/
+
+static size_t main_dedupinputs_cut
+(
+    unsigned char const * restrict data,
+    size_t                         size,
+    unsigned long const * restrict gear
+)
+{
+    unsigned long mask;
+    unsigned long hash;
+    size_t        limit;
+    size_t        position;
+
+    CHECK ( MAIN_DEDUPMINIMUM > 32u );
+    CHECK ( MAIN_DEDUPMAXIMUM > MAIN_DEDUPMINIMUM );
+
+    mask =  ( ( 1ul << MAIN_DEDUPBITS ) - 1u ) << ( 32u - MAIN_DEDUPBITS );
+    hash =  0;
+    limit = ( size < MAIN_DEDUPMAXIMUM ) ? size : MAIN_DEDUPMAXIMUM;
+
+    /*
+    ** Only the last 32 bytes before the minimum size affect the hash there,
+    *  so the bytes before them need not be hashed at all.
+    */
+
+    position = ( limit > MAIN_DEDUPMINIMUM ) ? ( MAIN_DEDUPMINIMUM - 32u ) : limit;
+
+    while ( position < limit )
+    {
+        hash =      ( ( hash << 1 ) + gear[data[position]] ) & 0xFFFFFFFFul;
+        position += 1u;
+
+        if ( ( position > MAIN_DEDUPMINIMUM ) && ( ( hash & mask ) == 0 ) )
+        {
+            limit = position;
+        }
+    }
+
+    return ( limit );
+}
+
+
+
+/*
+** main_dedupinputs_grow function
+*
+*  This function enlarges a heap allocation that doubles in capacity whenever
+*  it is full, as the lists of "main_dedupinputs" do.
+*
+*  Parameter(s)
+*
+*  list:      pointer to the heap allocation, or "NULL" for none yet
+*  needed:    the number of elements the heap allocation must hold, which
+*             exceeds its capacity
+*  capacity:  pointer to the number of elements the heap allocation holds,
+*             which this function updates
+*  size:      the size of an element in bytes
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; the heap allocation failed (the original one remains)
+*  !=NULL:  success; pointer to the enlarged heap allocation, which replaces
+*           the original one
+*/
+
+static void * main_dedupinputs_grow
+(
+    void * restrict   list,
+    size_t            needed,
+    size_t * restrict capacity,
+    size_t            size
+)
+{
+    bool   success;
+    void * larger;
+    size_t allocated;
+
+    success =   true;
+    allocated = ( *capacity > 0 ) ? *capacity : 64u;
+
+    while ( success && ( allocated < needed ) )
+    {
+        success =   allocated <= ( ( SIZE_MAX / size ) / 2u );
+        allocated = allocated * 2u;
+    }
+
+    larger = success ? realloc ( list,
+                                 size * allocated ) : NULL;
+
+    if ( larger != NULL )
+    {
+        *capacity = allocated;
+    }
+
+    return ( larger );
+}
+
+
+
+/*
+** main_releasededup function
+*
+*  This function releases the heap allocations of the deduplication of the
+*  "-y" option.
+*
+*  Parameter(s)
+*
+*  dedup:    pointer to the description of the deduplication, whose members
+*            are either heap allocations or "NULL"
+*  incount:  number of input binary files
+*/
+
+static void main_releasededup
+(
+    main_dedup * restrict dedup,
+    int                   incount
+)
+{
+    if ( dedup->tables != NULL )
+    {
+        int input;
+
+        for ( input = 0; input < incount; input += 1 )
+        {
+            if ( dedup->tables[input] != NULL )
+            {
+                free ( dedup->tables[input] );
+            }
+        }
+
+        free ( dedup->tables );
+    }
+
+    if ( dedup->sizes != NULL )
+    {
+        free ( dedup->sizes );
+    }
+
+    if ( dedup->counts != NULL )
+    {
+        free ( dedup->counts );
+    }
+
+    if ( dedup->origins != NULL )
+    {
+        free ( dedup->origins );
+    }
+
+    if ( dedup->pool != NULL )
+    {
+        free ( dedup->pool );
+    }
+
+    dedup->pool =     NULL;
+    dedup->poolsize = 0;
+    dedup->origins =  NULL;
+    dedup->tables =   NULL;
+    dedup->counts =   NULL;
+    dedup->sizes =    NULL;
+}
+
+
+
+/*
+** main_dedupinputs function
+*
+*  This function finds what the input binary files have in common for the "-y"
+*  option: the input binary files that duplicate an earlier one and the chunks
+*  that several input binary files share, which form the shared pool.
+*
+*  Parameter(s)
+*
+*  inpaths:  pointer to the pathnames of the input binary files
+*  incount:  number of input binary files
+*  dedup:    pointer to the description of the deduplication, which this
+*            function fills in; the caller must release it with
+*            "main_releasededup"
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as an input binary file not being
+*            readable or a heap allocation failing
+*  !=false:  success; the description is complete
+*
+*  Remarks
+*
+*  Every input binary file splits into chunks with "main_dedupinputs_cut" and
+*  each unique chunk's data is kept once, which an open-addressing hash table
+*  finds (comparing the data itself, so hash collisions are harmless).  An
+*  input binary file duplicates an earlier one when it has the same size and
+*  sequence of chunks.  Otherwise, when any of its chunks is in another input
+*  binary file, all of its chunks join the shared pool, in the order of their
+*  first appearance, so that the first input binary file to have a run of
+*  chunks has them contiguously.  Unlike the rest of this program, this
+*  function needs the input binary files' unique data in memory.
+*/
+
+static bool main_dedupinputs
+(
+    char * const * restrict inpaths,
+    int                     incount,
+    main_dedup * restrict   dedup
+)
+{
+    bool                     success;
+    unsigned long            gear[256];
+    unsigned char * restrict data;
+    unsigned char * restrict store;
+    main_chunk * restrict    chunks;
+    unsigned long * restrict slots;
+    unsigned long * restrict sequence;
+    size_t * restrict        firsts;
+    size_t * restrict        lengths;
+    unsigned long * restrict digests;
+    size_t                   datacapacity;
+    size_t                   storesize;
+    size_t                   storecapacity;
+    size_t                   chunkcount;
+    size_t                   chunkcapacity;
+    size_t                   slotcount;
+    size_t                   sequencecount;
+    size_t                   sequencecapacity;
+
+    dedup->pool =     NULL;
+    dedup->poolsize = 0;
+    dedup->tables =   NULL;
+
+    data =             NULL;
+    store =            NULL;
+    chunks =           NULL;
+    sequence =         NULL;
+    datacapacity =     0;
+    storesize =        0;
+    storecapacity =    0;
+    chunkcount =       0;
+    chunkcapacity =    0;
+    slotcount =        1024u;
+    sequencecount =    0;
+    sequencecapacity = 0;
+
+    success =  ( size_t ) incount <= ( SIZE_MAX / sizeof ( *dedup->tables ) );
+
+    dedup->origins = success ? ( int * ) malloc ( sizeof ( *dedup->origins ) * ( size_t ) incount ) : NULL;
+    success &=       dedup->origins != NULL;
+
+    dedup->counts =  success ? ( unsigned long * ) calloc ( ( size_t ) incount,
+                                                            sizeof ( *dedup->counts ) ) : NULL;
+    success &=       dedup->counts != NULL;
+
+    dedup->sizes =   success ? ( unsigned long * ) malloc ( sizeof ( *dedup->sizes ) * ( size_t ) incount ) : NULL;
+    success &=       dedup->sizes != NULL;
+
+    firsts =         success ? ( size_t * ) malloc ( sizeof ( *firsts ) * ( size_t ) incount ) : NULL;
+    success &=       firsts != NULL;
+
+    lengths =        success ? ( size_t * ) malloc ( sizeof ( *lengths ) * ( size_t ) incount ) : NULL;
+    success &=       lengths != NULL;
+
+    digests =        success ? ( unsigned long * ) malloc ( sizeof ( *digests ) * ( size_t ) incount ) : NULL;
+    success &=       digests != NULL;
+
+    slots =          success ? ( unsigned long * ) calloc ( slotcount,
+                                                            sizeof ( *slots ) ) : NULL;
+    success &=       slots != NULL;
+
+    dedup->tables =  success ? ( unsigned long * * ) malloc ( sizeof ( *dedup->tables ) * ( size_t ) incount ) : NULL;
+    success &=       dedup->tables != NULL;
+
+    if ( success )
+    {
+        int input;
+
+        for ( input = 0; input < incount; input += 1 )
+        {
+            dedup->tables[input] = NULL;
+        }
+
+    }
+
+    /*
+    ** The gear hash's values come from a fixed xorshift sequence, so that the
+    *  same input binary files always split into the same chunks.
+    */
+
+    {
+        unsigned long state;
+        unsigned int  index;
+
+        state = 2463534242ul;
+
+        for ( index = 0; index < 256u; index += 1u )
+        {
+            state ^=     ( state << 13 ) & 0xFFFFFFFFul;
+            state ^=     state >> 17;
+            state ^=     ( state << 5 ) & 0xFFFFFFFFul;
+            gear[index] = state;
+        }
+
+    }
+
+    {
+        int input;
+
+        for ( input = 0; success && ( input < incount ); input += 1 )
+        {
+            FILE * restrict infile;
+            size_t          size;
+            size_t          position;
+            size_t          length;
+
+            infile =  fopen ( inpaths[input],
+                              "rb" );
+            success = infile != NULL;
+            size =    0;
+
+            while ( success )
+            {
+
+                if ( size == datacapacity )
+                {
+                    void * larger;
+
+                    larger =  main_dedupinputs_grow ( data,
+                                                      size + 1u,
+                                                      &datacapacity,
+                                                      sizeof ( *data ) );
+                    success = larger != NULL;
+
+                    if ( success )
+                    {
+                        data = ( unsigned char * ) larger;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                size += fread ( data + size,
+                                sizeof ( *data ),
+                                datacapacity - size,
+                                infile );
+
+                if ( ferror ( infile ) )
+                {
+                    success = false;
+                }
+
+                if ( feof ( infile ) )
+                {
+                    break;
+                }
+
+            }
+
+            if ( infile != NULL )
+            {
+                fclose ( infile );
+            }
+
+            success &= size <= ( unsigned long ) LONG_MAX;
+
+            if ( success )
+            {
+                dedup->sizes[input] = ( unsigned long ) size;
+                digests[input] =      main_hashdata ( data,
+                                                      size );
+                firsts[input] =       sequencecount;
+            }
+
+            for ( position = 0; success && ( position < size ); position += length )
+            {
+                unsigned long hash;
+                size_t        slot;
+                size_t        chunk;
+
+                length = main_dedupinputs_cut ( data + position,
+                                                size - position,
+                                                gear );
+                hash =   main_hashdata ( data + position,
+                                         length );
+                slot =   ( size_t ) hash & ( slotcount - 1u );
+
+                while ( slots[slot] != 0 )
+                {
+                    main_chunk const * restrict candidate;
+
+                    candidate = &chunks[slots[slot] - 1u];
+
+                    if ( ( candidate->hash == hash ) && ( candidate->size == length ) && ( memcmp ( store + candidate->offset,
+                                                                                                    data + position,
+                                                                                                    length ) == 0 ) )
+                    {
+                        break;
+                    }
+
+                    slot = ( slot + 1u ) & ( slotcount - 1u );
+                }
+
+                /*
+                ** A new chunk's data joins the unique chunks' data, and the
+                *  hash table doubles in size whenever it is half full.
+                */
+
+                if ( slots[slot] == 0 )
+                {
+
+                    if ( ( storesize + length ) > storecapacity )
+                    {
+                        void * larger;
+
+                        larger =  main_dedupinputs_grow ( store,
+                                                          storesize + length,
+                                                          &storecapacity,
+                                                          sizeof ( *store ) );
+                        success = larger != NULL;
+
+                        if ( success )
+                        {
+                            store = ( unsigned char * ) larger;
+                        }
+                    }
+
+                    if ( success && ( chunkcount == chunkcapacity ) )
+                    {
+                        void * larger;
+
+                        larger =  main_dedupinputs_grow ( chunks,
+                                                          chunkcount + 1u,
+                                                          &chunkcapacity,
+                                                          sizeof ( *chunks ) );
+                        success = larger != NULL;
+
+                        if ( success )
+                        {
+                            chunks = ( main_chunk * ) larger;
+                        }
+                    }
+
+                    if ( !success )
+                    {
+                        break;
+                    }
+
+                    memcpy ( store + storesize,
+                             data + position,
+                             length );
+
+                    chunks[chunkcount].hash =   hash;
+                    chunks[chunkcount].offset = storesize;
+                    chunks[chunkcount].size =   length;
+                    chunks[chunkcount].owner =  0;
+                    chunks[chunkcount].refs =   0;
+                    chunks[chunkcount].placed = 0;
+
+                    storesize +=  length;
+                    chunkcount += 1u;
+                    slots[slot] = ( unsigned long ) chunkcount;
+
+                    if ( ( chunkcount * 2u ) > slotcount )
+                    {
+                        unsigned long * restrict larger;
+
+                        success = slotcount <= ( ( SIZE_MAX / sizeof ( *slots ) ) / 2u );
+
+                        larger =  success ? ( unsigned long * ) calloc ( slotcount * 2u,
+                                                                         sizeof ( *larger ) ) : NULL;
+                        success = larger != NULL;
+
+                        if ( success )
+                        {
+                            size_t index;
+
+                            slotcount *= 2u;
+
+                            for ( index = 0; index < chunkcount; index += 1u )
+                            {
+                                size_t spot;
+
+                                spot = ( size_t ) chunks[index].hash & ( slotcount - 1u );
+
+                                while ( larger[spot] != 0 )
+                                {
+                                    spot = ( spot + 1u ) & ( slotcount - 1u );
+                                }
+
+                                larger[spot] = ( unsigned long ) index + 1u;
+                            }
+
+                            free ( slots );
+                            slots = larger;
+                        }
+                    }
+
+                    chunk = chunkcount - 1u;
+                }
+                else
+                {
+                    chunk = ( size_t ) slots[slot] - 1u;
+                }
+
+                if ( success && ( sequencecount == sequencecapacity ) )
+                {
+                    void * larger;
+
+                    larger =  main_dedupinputs_grow ( sequence,
+                                                      sequencecount + 1u,
+                                                      &sequencecapacity,
+                                                      sizeof ( *sequence ) );
+                    success = larger != NULL;
+
+                    if ( success )
+                    {
+                        sequence = ( unsigned long * ) larger;
+                    }
+                }
+
+                if ( success )
+                {
+                    sequence[sequencecount] = ( unsigned long ) chunk;
+                    sequencecount +=          1u;
+                }
+            }
+
+            if ( success )
+            {
+                lengths[input] = sequencecount - firsts[input];
+            }
+        }
+
+    }
+
+    /*
+    ** Duplicates refer to the first input binary file with the same data,
+    *  whereas the others count the input binary files that have each chunk.
+    */
+
+    if ( success )
+    {
+        int input;
+
+        for ( input = 0; input < incount; input += 1 )
+        {
+            int    other;
+            size_t index;
+
+            dedup->origins[input] = input;
+
+            for ( other = 0; other < input; other += 1 )
+            {
+                if ( ( dedup->origins[other] == other ) && ( dedup->sizes[other] == dedup->sizes[input] ) && ( digests[other] == digests[input] ) && ( lengths[other] == lengths[input] ) )
+                {
+                    if ( ( lengths[input] == 0 ) || ( memcmp ( sequence + firsts[other],
+                                                               sequence + firsts[input],
+                                                               sizeof ( *sequence ) * lengths[input] ) == 0 ) )
+                    {
+                        dedup->origins[input] = other;
+                        break;
+                    }
+                }
+            }
+
+            for ( index = 0; ( dedup->origins[input] == input ) && ( index < lengths[input] ); index += 1u )
+            {
+                main_chunk * restrict chunk;
+
+                chunk = &chunks[sequence[firsts[input] + index]];
+
+                if ( chunk->owner != ( unsigned long ) input + 1u )
+                {
+                    chunk->owner = ( unsigned long ) input + 1u;
+                    chunk->refs += 1u;
+                }
+            }
+        }
+
+    }
+
+    /*
+    ** The chunk table has a pair of elements per chunk (the offset in the
+    *  shared pool and the size), but a chunk that continues the previous one
+    *  in the shared pool merely enlarges the previous pair.
+    */
+
+    if ( success )
+    {
+        size_t poolcapacity;
+        int    input;
+
+        poolcapacity = 0;
+
+        for ( input = 0; success && ( input < incount ); input += 1 )
+        {
+            bool   shared;
+            size_t index;
+
+            shared = false;
+
+            for ( index = 0; ( dedup->origins[input] == input ) && ( index < lengths[input] ); index += 1u )
+            {
+                shared |= chunks[sequence[firsts[input] + index]].refs > 1u;
+            }
+
+            if ( shared )
+            {
+                unsigned long * restrict table;
+                unsigned long            count;
+
+                success = lengths[input] <= ( ( SIZE_MAX / sizeof ( *table ) ) / 2u );
+                table =   success ? ( unsigned long * ) malloc ( sizeof ( *table ) * lengths[input] * 2u ) : NULL;
+                success = table != NULL;
+                count =   0;
+
+                dedup->tables[input] = table;
+
+                for ( index = 0; success && ( index < lengths[input] ); index += 1u )
+                {
+                    main_chunk * restrict chunk;
+                    unsigned long         offset;
+
+                    chunk = &chunks[sequence[firsts[input] + index]];
+
+                    if ( chunk->placed == 0 )
+                    {
+
+                        if ( ( ( size_t ) dedup->poolsize + chunk->size ) > poolcapacity )
+                        {
+                            void * larger;
+
+                            larger =  main_dedupinputs_grow ( dedup->pool,
+                                                              ( size_t ) dedup->poolsize + chunk->size,
+                                                              &poolcapacity,
+                                                              sizeof ( *dedup->pool ) );
+                            success = larger != NULL;
+
+                            if ( success )
+                            {
+                                dedup->pool = ( unsigned char * ) larger;
+                            }
+                            else
+                            {
+                                break;
+                            }
+                        }
+
+                        success &= chunk->size <= ( unsigned long ) ( LONG_MAX - dedup->poolsize );
+
+                        memcpy ( dedup->pool + dedup->poolsize,
+                                 store + chunk->offset,
+                                 chunk->size );
+
+                        chunk->placed =    dedup->poolsize + 1u;
+                        dedup->poolsize += ( unsigned long ) chunk->size;
+                    }
+
+                    offset = chunk->placed - 1u;
+
+                    if ( ( count > 0 ) && ( ( table[count - 2u] + table[count - 1u] ) == offset ) )
+                    {
+                        table[count - 1u] += ( unsigned long ) chunk->size;
+                    }
+                    else
+                    {
+                        table[count] =      offset;
+                        table[count + 1u] = ( unsigned long ) chunk->size;
+                        count +=            2u;
+                    }
+                }
+
+                dedup->counts[input] = count;
+            }
+        }
+
+    }
+
+    if ( digests != NULL )
+    {
+        free ( digests );
+    }
+
+    if ( lengths != NULL )
+    {
+        free ( lengths );
+    }
+
+    if ( firsts != NULL )
+    {
+        free ( firsts );
+    }
+
+    if ( slots != NULL )
+    {
+        free ( slots );
+    }
+
+    if ( sequence != NULL )
+    {
+        free ( sequence );
+    }
+
+    if ( chunks != NULL )
+    {
+        free ( chunks );
+    }
+
+    if ( store != NULL )
+    {
+        free ( store );
+    }
+
+    if ( data != NULL )
+    {
+        free ( data );
+    }
+
+    if ( !success )
+    {
+        main_releasededup ( dedup,
+                            incount );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_readbase function
+*
+*  This function reads the whole base of the "-v" option into memory, against
+*  which every input binary file's delta refers (or the whole access trace of
+*  the "-o" option).
+*
+*  Parameter(s)
+*
+*  path:  pointer to the pathname of the base
+*  size:  pointer to the variable that receives the size of the base
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as the base not being readable or
+*           a heap allocation failing
+*  !=NULL:  success; pointer to the base's data (the caller must release this
+*           heap allocation)
+*/
+
+static unsigned char * restrict main_readbase
+(
+    char const * restrict    path,
+    unsigned long * restrict size
+)
+{
+    bool                     success;
+    unsigned char * restrict data;
+    size_t                   capacity;
+    size_t                   total;
+    FILE * restrict          infile;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *data ) ) >= MAIN_CHUNKSIZE );
+
+    capacity = MAIN_CHUNKSIZE;
+    total =    0;
+
+    data =     ( unsigned char * ) malloc ( sizeof ( *data ) * capacity );
+    success =  data != NULL;
+
+    infile =   fopen ( path,
+                       "rb" );
+    success &= infile != NULL;
+
+    while ( success )
+    {
+
+        if ( total == capacity )
+        {
+            unsigned char * restrict larger;
+
+            success =  capacity <= ( ( SIZE_MAX / sizeof ( *data ) ) / 2u );
+            capacity = capacity * 2u;
+
+            larger =  success ? ( unsigned char * ) realloc ( data,
+                                                              sizeof ( *data ) * capacity ) : NULL;
+            success = larger != NULL;
+
+            if ( success )
+            {
+                data = larger;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        total += fread ( data + total,
+                         sizeof ( *data ),
+                         capacity - total,
+                         infile );
+
+        if ( ferror ( infile ) )
+        {
+            success = false;
+        }
+
+        if ( feof ( infile ) )
+        {
+            break;
+        }
+
+    }
+
+    if ( infile != NULL )
+    {
+        fclose ( infile );
+    }
+
+    success &= total <= ( unsigned long ) LONG_MAX;
+    *size =    ( unsigned long ) total;
+
+    if ( !success && ( data != NULL ) )
+    {
+        free ( data );
+        data = NULL;
+    }
+
+    return ( data );
+}
+
+
+
+/*
+** main_readtrace_match function
+*
+*  This function compares a name of the access trace of the "-o" option with
+*  an input binary file's name, with or without its extension.
+*
+*  Parameter(s)
+*
+*  name:    pointer to the input binary file's name (with the extension)
+*  line:    pointer to the name of the access trace, which is not terminated
+*  length:  the number of characters of the name of the access trace
+*
+*  Return value(s)
+*
+*  ==false:  the names differ
+*  !=false:  the names match
+*/
+
+static bool main_readtrace_match
+(
+    char const * restrict name,
+    char const * restrict line,
+    size_t                length
+)
+{
+    size_t namelength;
+
+    namelength = strlen ( name );
+
+    if ( ( namelength < length ) || ( memcmp ( name,
+                                               line,
+                                               length ) != 0 ) )
+    {
+        return ( false );
+    }
+
+    return ( ( namelength == length ) || ( ( name[length] == '.' ) && ( strchr ( name + length + 1u,
+                                                                                  '.' ) == NULL ) ) );
+}
+
+
+
+/*
+** main_readtrace function
+*
+*  This function reads the access trace of the "-o" option and orders the
+*  input binary files by it: the ones that the trace names first, in the order
+*  of their first access, then the others, in the order of the command line.
+*
+*  Parameter(s)
+*
+*  path:      pointer to the pathname of the access trace
+*  inpaths:   pointer to the pathnames of the input binary files
+*  incount:   the number of input binary files
+*  hotcount:  pointer to the variable that receives the number of input binary
+*             files that the trace names (i.e.: the hot ones)
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as the access trace not being
+*           readable or a heap allocation failing
+*  !=NULL:  success; pointer to the indices of the input binary files, in their
+*           new order (the caller must release this heap allocation)
+*
+*  Remarks
+*
+*  The access trace is a text file with a name per line, such as a program
+*  records when it first touches each of its resources: the input binary
+*  file's name, with or without the extension (but without the path), so that
+*  both the names of "bin2c_pack.h" and those of the accessors match.  Spaces
+*  and tabs around a name are ignored, and so are empty lines, repeated names
+*  and names of no input binary file (i.e.: of resources from elsewhere, or
+*  misspelled ones), for which a warning is output to the standard error.
+*/
+
+static int * restrict main_readtrace
+(
+    char const * restrict   path,
+    char * const * restrict inpaths,
+    int                     incount,
+    int * restrict          hotcount
+)
+{
+    bool                     success;
+    unsigned char * restrict data;
+    unsigned long            size;
+    int * restrict           order;
+    bool * restrict          placed;
+
+    order =  NULL;
+    placed = NULL;
+
+    data =    main_readbase ( path,
+                              &size );
+    success = data != NULL;
+
+    if ( success )
+    {
+        success = ( size_t ) incount <= ( SIZE_MAX / sizeof ( *order ) );
+    }
+
+    if ( success )
+    {
+        order =   ( int * ) malloc ( sizeof ( *order ) * ( ( size_t ) incount + 1u ) );
+        placed =  ( bool * ) calloc ( ( size_t ) incount + 1u,
+                                      sizeof ( *placed ) );
+        success = ( order != NULL ) && ( placed != NULL );
+    }
+
+    if ( success )
+    {
+        unsigned long start;
+        unsigned long number;
+        int           count;
+        int           input;
+
+        count = 0;
+
+        start =  0;
+        number = 0;
+
+        while ( start < size )
+        {
+            unsigned long end;
+            unsigned long next;
+            bool          matched;
+
+            end =     start;
+            matched = false;
+            number += 1u;
+
+            while ( ( end < size ) && ( data[end] != '\n' ) )
+            {
+                end += 1u;
+            }
+
+            next = end + 1u;
+
+            while ( ( start < end ) && ( ( data[start] == ' ' ) || ( data[start] == '\t' ) ) )
+            {
+                start += 1u;
+            }
+
+            while ( ( end > start ) && ( ( data[end - 1u] == ' ' ) || ( data[end - 1u] == '\t' ) || ( data[end - 1u] == '\r' ) ) )
+            {
+                end -= 1u;
+            }
+
+            /*
+            ** A repeated name matches an input binary file that is placed
+            *  already, so only a name that matches none of them is unknown.
+            */
+
+            for ( input = 0; ( end > start ) && ( input < incount ); input += 1 )
+            {
+                if ( main_readtrace_match ( main_findname ( inpaths[input] ),
+                                            ( char const * ) data + start,
+                                            ( size_t ) ( end - start ) ) )
+                {
+                    matched = true;
+
+                    if ( !placed[input] )
+                    {
+                        placed[input] = true;
+                        order[count] =  input;
+                        count +=        1;
+                        break;
+                    }
+                }
+            }
+
+            if ( ( end > start ) && !matched )
+            {
+                ( void ) fprintf ( stderr,
+                                   "-o: line %lu of \"%s\" names no input file: \"%.*s\"\n",
+                                   number,
+                                   path,
+                                   ( int ) ( end - start ),
+                                   ( char const * ) data + start );
+            }
+
+            start = next;
+        }
+
+        *hotcount = count;
+
+        for ( input = 0; input < incount; input += 1 )
+        {
+            if ( !placed[input] )
+            {
+                order[count] = input;
+                count +=       1;
+            }
+        }
+    }
+
+    if ( !success && ( order != NULL ) )
+    {
+        free ( order );
+        order = NULL;
+    }
+
+    if ( placed != NULL )
+    {
+        free ( placed );
+    }
+
+    if ( data != NULL )
+    {
+        free ( data );
+    }
+
+    return ( order );
+}
+
+
+
+/*
+** main_shortenname function
+*
+*  This function a truncates a pathname to remove its file extension.  It also
+*  finds the portion that contains the file name and returns a pointer to that
+*  substring.  This function assumes a prior call of the "main_constructoutname"
+*  function returned successfully.
+*
+*  Parameter(s)
+*
+*  path:  pointer to the pathname, which may be just the file name
+*
+*  Return value(s)
+*
+*  !=NULL:  pointer to the file name, which does not include the extension
+*
+*  Remarks
+*
+*  This function limits the "path" parameter length, including the null-
+*  terminating character, to "USHRT_MAX".  That is rather long for a file path
+*  (at least 65535 characters); so, the limit is simiply a best-effort attempt
+*  at gracefully exiting (instead of causing an access violation exception).
+*/
+
+static char const * restrict main_shortenname
+(
+    char * restrict path
+)
+{
+    unsigned short terminus;
+    unsigned short delimiter;
+
+    /*
+    ** Finding the file name and truncating its extension, if any is present,
+    *  depends on finding the last slash character, if any is present.  This
+    *  function assumes that "main_constructoutname" previously return
+    *  successfully and, therefore, does not ensure that the path includes a
+    *  terminating null character (and that there are no more full stops).
+    */
+
+    {
+        unsigned short length;
+
+        CHECK ( sizeof ( length ) <= sizeof ( path ) );
+
+        length =    USHRT_MAX;
+        terminus =  0;
+        delimiter = 0;
+
+        while ( length > 0 )
+        {
+
+            if ( *path == '.' )
+            {
+                terminus = length;
+            }
+            else if ( *path == MAIN_PATHDELIMITER )
+            {
+                terminus =  0;
+                delimiter = ( USHRT_MAX - length ) + 1u;
+            }
+            else if ( *path == '\0' )
+            {
+                break;
+            }
+
+            length -= 1u;
+            path +=   1u;
+
+        }
+
+        path -= ( USHRT_MAX - length ) - delimiter;
+
+    }
+
+    /*
+    ** Truncating the pathname to remove the file extension, if any is present,
+    *  is just a simple over-writing of the full stop with a terminating null
+    *  character.  (The file extension remains untouched, albeit invisible.)
+    */
+
+    if ( terminus > 0 )
+    {
+        terminus =       ( USHRT_MAX - terminus ) - delimiter;
+        path[terminus] = '\0';
+    }
+
+    return ( path );
+}
+
+
+
+/*
+** main_constructoutpath function
+*
+*  This function copies the input pathname into a heap allocation and replaces
+*  the input file's extension, if any is present, with a ". " extension so that
+*  the caller can replace the whitespace with C language file extensions.  The
+*  caller must use the "free" function to release the heap allocation.
+*
+*  Parameter(s)
+*
+*  inpath:  pointer to the input pathname, which may be just the file name
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as "binpath" being too long or
+*           the heap allocation failing
+*  !=NULL:  success; pointer to the output path (the caller must release this
+*           heap allocation)
+*
+*  Remarks
+*
+*  This function limits the "inpath" parameter length, including the null-
+*  terminating character, to "USHRT_MAX".  That is rather long for a file path
+*  (at least 65535 characters); so, the limit is simiply a best-effort attempt
+*  at gracefully exiting (instead of causing an access violation exception).
+*/
+
+static char * restrict main_constructoutpath
+(
+    char const * restrict inpath
+)
+{
+    char * restrict outpath;
+    unsigned short  length;
+    unsigned short  offset;
+
+    outpath = NULL;
+
+    /*
+    ** Finding the file extension depends on finding the last full stop, if any
+    *  is present, after finding the last slash delimiter, if any is present.
+    */
+
+    CHECK ( sizeof ( length ) <= sizeof ( inpath ) );
+
+    length = USHRT_MAX;
+    offset = USHRT_MAX;
+
+    while ( length > 0 )
+    {
+
+        if ( *inpath == '.' )
+        {
+            offset = length;
+        }
+        else if ( *inpath == MAIN_PATHDELIMITER )
+        {
+            offset = USHRT_MAX;
+        }
+        else if ( *inpath == '\0' )
+        {
+            break;
+        }
+
+        length -=  1u;
+        inpath += 1u;
+
+    }
+
+    /*
+    ** Heap allocation only needs extra capacity of exactly three characters to
+    *  accommodate the output pathname's ". " extension and the null-terminating
+    *  character.
+    */
+
+    if ( *inpath == '\0' )
+    {
+
+        inpath -= ( USHRT_MAX - length );
+
+        if ( offset != USHRT_MAX )
+        {
+            length = offset;
+        }
+
+        CHECK ( ( SIZE_MAX / sizeof ( *outpath ) ) >= USHRT_MAX );
+
+        if ( length >= ( 2u + 1u ) )
+        {
+            length =  USHRT_MAX - length;
+            outpath = ( char * ) malloc ( sizeof ( *outpath ) * ( length + 2u + 1u ) );
+        }
+
+    }
+
+    /*
+    ** This is a specialized string copy algorithm due to the need to ignore
+    *  the input pathname's extension, if any is present, and to copy ". " into
+    *  the output pathname instead.
+    */
+
+    if ( outpath != NULL )
+    {
+
+        offset = length;
+
+        while ( length > 0 )
+        {
+
+            *outpath = *inpath;
+
+            length -=  1u;
+            inpath +=  1u;
+            outpath += 1u;
+
+        }
+
+        *outpath = '.';
+        outpath += 1u;
+        *outpath = ' ';
+        outpath += 1u;
+
+        *outpath = '\0';
+        outpath -= 2u;
+
+        outpath -= offset;
+
+    }
+
+    return ( outpath );
+}
+
+
+
+/*
+** main_constructfullpath function
+*
+*  This function copies the full pathname of an input binary file (i.e.: one
+*  that does not depend on the working directory) into a heap allocation.  The
+*  caller must use the "free" function to release the heap allocation.
+*
+*  Parameter(s)
+*
+*  inpath:  pointer to the input pathname, which may be just the file name
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; the heap allocation failed
+*  !=NULL:  success; pointer to the full pathname (the caller must release this
+*           heap allocation)
+*
+*  Remarks
+*
+*  Windows has the "_fullpath" function and POSIX has the "realpath" function,
+*  which also resolves symbolic links.  Elsewhere, or when they fail, this
+*  function copies the input pathname as is.
+*/
+
+static char * restrict main_constructfullpath
+(
+    char const * restrict inpath
+)
+{
+    char * restrict fullpath;
+
+#if defined ( _WIN32 ) || defined ( _WIN64 )
+    fullpath = _fullpath ( NULL,
+                           inpath,
+                           0 );
+#elif defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )
+    fullpath = realpath ( inpath,
+                          NULL );
+#else
+    fullpath = NULL;
+#endif
+
+    if ( fullpath == NULL )
+    {
+        fullpath = ( char * ) malloc ( sizeof ( *fullpath ) * ( strlen ( inpath ) + 1u ) );
+
+        if ( fullpath != NULL )
+        {
+            strcpy ( fullpath,
+                     inpath );
+        }
+    }
+
+    return ( fullpath );
+}
+
+
+
+/*
+** main_constructsharedpath function
+*
+*  This function constructs the output pathname of an array that does not
+*  belong to a single input binary file (e.g.: the shared dictionary of the
+*  "-d" option), which is the given input binary file's directory and the
+*  array's name, as if it were an input binary file itself.  The caller must use
+*  the "free" function to release the heap allocation.
+*
+*  Parameter(s)
+*
+*  inpath:  pointer to the pathname of an input binary file, whose directory
+*           receives the array's C file(s)
+*  name:    pointer to the name of the output C file(s), without an extension
+*
+*  Return value(s)
+*
+*  ==NULL:  failure; an error occurred, such as the heap allocation failing
+*  !=NULL:  success; pointer to the output path, with the ". " extension of
+*           "main_constructoutpath" (the caller must release this heap
+*           allocation)
+*/
+
+static char * restrict main_constructsharedpath
+(
+    char const * restrict inpath,
+    char const * restrict name
+)
+{
+    char * restrict outpath;
+    char * restrict path;
+    size_t          directory;
+
+    outpath = NULL;
+
+    directory = ( size_t ) ( main_findname ( inpath ) - inpath );
+
+    path = ( char * ) malloc ( sizeof ( *path ) * ( directory + strlen ( name ) + 1u ) );
+
+    if ( path != NULL )
+    {
+        memcpy ( path,
+                 inpath,
+                 directory );
+        strcpy ( path + directory,
+                 name );
+
+        outpath = main_constructoutpath ( path );
+
+        free ( path );
+    }
+
+    return ( outpath );
+}
+
+
+
+/*
+** main_runarray function
+*
+*  This function outputs data that does not belong to a single input binary
+*  file (i.e.: the shared data of "main_runshared" or the pack of the "-u"
+*  option) as an array in its own C file(s), which reside next to the given
+*  input binary file's.
+*
+*  Parameter(s)
+*
+*  inpath:     pointer to the pathname of an input binary file, whose directory
+*              receives the array's C file(s)
+*  name:       pointer to the name of the array (e.g.: the "<dictionary>"
+*              parameter)
+*  infile:     pointer to the "FILE" object for the data, at its start
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the output file(s) have the data
+*
+*  Remarks
+*
+*  The array is uncompressed, and "main_runbin2c" outputs it like any input
+*  binary file's, so it follows the same naming and form.  However, many
+*  output C files refer to it, so it always has global scope: when neither the
+*  "-g" nor the "-l" option is present, it has a "-g" option-style macro for
+*  its size, with the "_size" suffix.
+*/
+
+static bool main_runarray
+(
+    char const * restrict           inpath,
+    char const * restrict           name,
+    FILE * restrict                 infile,
+    main_arguments const * restrict arguments
+)
+{
+    bool            success;
+    main_arguments  settings;
+    char * restrict outpath;
+
+    settings =            *arguments;
+    settings.end =        NULL;
+    settings.shards =     NULL;
+    settings.padding =    NULL;
+    settings.codec =      NULL;
+    settings.coding =     MAIN_CODEC_NONE;
+    settings.window =     NULL;
+    settings.blocks =     NULL;
+    settings.blocksize =  0;
+    settings.hashsize =   0;
+    settings.dictionary = NULL;
+    settings.trained =    NULL;
+    settings.dictsize =   0;
+    settings.pool =       NULL;
+    settings.base =       NULL;
+    settings.pack =       NULL;
+
+    if ( ( settings.form == MAIN_FORM_DEFAULT ) && ( settings.global == NULL ) && ( settings.extent == NULL ) )
+    {
+        settings.global = "_size";
+    }
+
+    outpath = main_constructsharedpath ( inpath,
+                                         name );
+    success = outpath != NULL;
+
+    if ( success )
+    {
+        success = main_runbin2c ( infile,
+                                  name,
+                                  &settings,
+                                  outpath );
+
+        free ( outpath );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runshared function
+*
+*  This function outputs data that many input binary files share (i.e.: the
+*  shared dictionary of the "-d" option, the shared pool of the "-y" option or
+*  the base of the "-v" option) as an array in its own C file(s), which reside
+*  next to the given input binary file's.
+*
+*  Parameter(s)
+*
+*  inpath:     pointer to the pathname of an input binary file, whose directory
+*              receives the array's C file(s)
+*  name:       pointer to the name of the array (i.e.: the "<dictionary>" or
+*              "<pool>" parameter, or the base's name)
+*  data:       pointer to the shared data
+*  size:       the number of bytes of the shared data
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the output file(s) have the shared data
+*
+*  Remarks
+*
+*  The shared data is in memory, whereas "main_runbin2c" reads a "FILE" object,
+*  so it goes through a temporary file on the way to "main_runarray".
+*/
+
+static bool main_runshared
+(
+    char const * restrict           inpath,
+    char const * restrict           name,
+    unsigned char const * restrict  data,
+    unsigned long                   size,
+    main_arguments const * restrict arguments
+)
+{
+    bool            success;
+    FILE * restrict infile;
+
+    infile =  tmpfile ( );
+    success = infile != NULL;
+
+    if ( success )
+    {
+        success = fwrite ( data,
+                           sizeof ( *data ),
+                           ( size_t ) size,
+                           infile ) == ( size_t ) size;
+
+        rewind ( infile );
+    }
+
+    if ( success )
+    {
+        success = main_runarray ( inpath,
+                                  name,
+                                  infile,
+                                  arguments );
+    }
+
+    if ( infile != NULL )
+    {
+        fclose ( infile );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runcache_outputcacher function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_cache.h", that holds the decompression cache of the "-q"
+*  option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runcache_outputcacher
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c decompression cache\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-q\" option,\n",
+        "*  whose header files define a \"_cached\" function per array that returns the\n",
+        "*  input file's decoded data from a cache, so that only the first use (or the\n",
+        "*  first use after an eviction) decodes it.  The cache holds at most \"budget\"\n",
+        "*  bytes of decoded data (approximately, given that shards decode at the same\n",
+        "*  time), and evicts the least recently used data to make room: of the shard\n",
+        "*  that missed first, and then of the other shards whose lock is free.\n",
+        "*  Hits take no lock: a hit pins the data, which is safe from eviction until\n",
+        "*  \"bin2c_cache_release\" unpins it.  A miss locks its shard while it decodes.\n",
+        "*  Evicted memory is kept for the next miss, but given back to the system\n",
+        "*  (e.g.: with \"MADV_FREE\"), which reclaims it only under memory pressure.\n",
+        "*  Data that does not fit in the budget is decoded into memory of its own.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_CACHE_H__ )\n",
+        "\n",
+        "#define __BIN2C_CACHE_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <stdlib.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( _WIN32 )\n",
+        "#if !defined ( WIN32_LEAN_AND_MEAN )\n",
+        "#define WIN32_LEAN_AND_MEAN\n",
+        "#endif\n",
+        "#include <windows.h>\n",
+        "#define BIN2C_CACHE_WINDOWS\n",
+        "#elif defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )\n",
+        "#include <sys/types.h>\n",
+        "#include <sys/mman.h>\n",
+        "#include <unistd.h>\n",
+        "#if defined ( MAP_ANONYMOUS ) && ( defined ( MADV_FREE ) || defined ( MADV_DONTNEED ) )\n",
+        "#define BIN2C_CACHE_POSIX\n",
+        "#endif\n",
+        "#if defined ( _POSIX_PRIORITY_SCHEDULING )\n",
+        "#include <sched.h>\n",
+        "#endif\n",
+        "#endif\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_CACHE_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_CACHE_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_CACHE_API  static\n",
+        "#endif\n",
+        "\n",
+        "/*\n",
+        "** The number of shards, and of entries per shard, must be the same in every\n",
+        "*  translation unit.  A key's hash selects its shard.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( BIN2C_CACHE_SHARDS )\n",
+        "#define BIN2C_CACHE_SHARDS  16u\n",
+        "#endif\n",
+        "\n",
+        "#if !defined ( BIN2C_CACHE_WAYS )\n",
+        "#define BIN2C_CACHE_WAYS  32u\n",
+        "#endif\n",
+        "\n",
+        "/*\n",
+        "** Pins, clocks, locks and the number of bytes in use are atomic numbers, and\n",
+        "*  the shards are published with an atomic compare-and-swap, where the compiler\n",
+        "*  has them.  (Elsewhere, only one thread may use a cache.)\n",
+        "*/\n",
+        "\n",
+        "#if defined ( _MSC_VER )\n",
+        "#define BIN2C_CACHE_LOAD( value )                     InterlockedCompareExchange ( ( value ), 0, 0 )\n",
+        "#define BIN2C_CACHE_STORE( value, desired )           InterlockedExchange ( ( value ), ( desired ) )\n",
+        "#define BIN2C_CACHE_SWAP( value, expected, desired )  InterlockedCompareExchange ( ( value ), ( desired ), ( expected ) )\n",
+        "#define BIN2C_CACHE_ADD( value, amount )              InterlockedExchangeAdd ( ( value ), ( amount ) )\n",
+        "#define BIN2C_CACHE_LOADSIZE( value )                 InterlockedExchangeAddSizeT ( ( value ), 0 )\n",
+        "#define BIN2C_CACHE_ADDSIZE( value, amount )          InterlockedExchangeAddSizeT ( ( value ), ( amount ) )\n",
+        "#define BIN2C_CACHE_LOADSHARDS( shards )              InterlockedCompareExchangePointer ( ( void * volatile * ) ( shards ), NULL, NULL )\n",
+        "#define BIN2C_CACHE_PUBLISH( shards, fresh )          InterlockedCompareExchangePointer ( ( void * volatile * ) ( shards ), ( fresh ), NULL )\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_CACHE_LOAD( value )                     __atomic_load_n ( ( value ), __ATOMIC_ACQUIRE )\n",
+        "#define BIN2C_CACHE_STORE( value, desired )           __atomic_store_n ( ( value ), ( desired ), __ATOMIC_RELEASE )\n",
+        "#define BIN2C_CACHE_SWAP( value, expected, desired )  __sync_val_compare_and_swap ( ( value ), ( expected ), ( desired ) )\n",
+        "#define BIN2C_CACHE_ADD( value, amount )              __atomic_fetch_add ( ( value ), ( amount ), __ATOMIC_ACQ_REL )\n",
+        "#define BIN2C_CACHE_LOADSIZE( value )                 __atomic_load_n ( ( value ), __ATOMIC_ACQUIRE )\n",
+        "#define BIN2C_CACHE_ADDSIZE( value, amount )          __atomic_fetch_add ( ( value ), ( amount ), __ATOMIC_ACQ_REL )\n",
+        "#define BIN2C_CACHE_LOADSHARDS( shards )              __atomic_load_n ( ( shards ), __ATOMIC_ACQUIRE )\n",
+        "#define BIN2C_CACHE_PUBLISH( shards, fresh )          __sync_val_compare_and_swap ( ( shards ), NULL, ( fresh ) )\n",
+        "#else\n",
+        "#define BIN2C_CACHE_LOAD( value )                     ( *( value ) )\n",
+        "#define BIN2C_CACHE_STORE( value, desired )           ( *( value ) = ( desired ) )\n",
+        "#define BIN2C_CACHE_SWAP( value, expected, desired )  ( ( *( value ) == ( expected ) ) ? ( *( value ) = ( desired ), ( expected ) ) : *( value ) )\n",
+        "#define BIN2C_CACHE_ADD( value, amount )              ( ( *( value ) += ( amount ) ) - ( amount ) )\n",
+        "#define BIN2C_CACHE_LOADSIZE( value )                 ( *( value ) )\n",
+        "#define BIN2C_CACHE_ADDSIZE( value, amount )          ( ( *( value ) += ( amount ) ) - ( amount ) )\n",
+        "#define BIN2C_CACHE_LOADSHARDS( shards )              ( *( shards ) )\n",
+        "#define BIN2C_CACHE_PUBLISH( shards, fresh )          ( ( *( shards ) == NULL ) ? ( ( *( shards ) = ( fresh ) ), ( bin2c_cache_shard * ) NULL ) : *( shards ) )\n",
+        "#endif\n",
+        "\n",
+        "/*\n",
+        "** An entry's tag is its key's hash, but never zero, which marks empty entries.\n",
+        "*/\n",
+        "\n",
+        "#define BIN2C_CACHE_TAG( hash )  ( ( long ) ( ( ( hash ) & 0x7FFFFFFFul ) | 1ul ) )\n",
+        "\n",
+        "#if defined ( BIN2C_CACHE_WINDOWS )\n",
+        "#define BIN2C_CACHE_YIELD( )  SwitchToThread ( )\n",
+        "#elif defined ( _POSIX_PRIORITY_SCHEDULING )\n",
+        "#define BIN2C_CACHE_YIELD( )  sched_yield ( )\n",
+        "#else\n",
+        "#define BIN2C_CACHE_YIELD( )  ( ( void ) 0 )\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_decoder type\n",
+        "*\n",
+        "*  A function that decodes an input file's data into \"dst\", which has room for\n",
+        "*  \"dstsize\" bytes (i.e.: the \"_decoded\" size).  Returns the number of decoded\n",
+        "*  bytes, which is anything but \"dstsize\" on failure.\n",
+        "*/\n",
+        "\n",
+        "typedef size_t ( * bin2c_cache_decoder ) ( unsigned char * dst, size_t dstsize );\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_entry type\n",
+        "*\n",
+        "*  An entry of a shard: its pins (the number of spans that use its data, or -1\n",
+        "*  while a miss or an eviction changes it), the clock of its last use, the tag\n",
+        "*  of its key, its key, its data, and the memory that holds the data (which\n",
+        "*  outlives the data).\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    long            pins;\n",
+        "    long            stamp;\n",
+        "    long            tag;\n",
+        "    char const *    key;\n",
+        "    unsigned char * data;\n",
+        "    size_t          size;\n",
+        "    void *          base;\n",
+        "    size_t          capacity;\n",
+        "} bin2c_cache_entry;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_shard type\n",
+        "*\n",
+        "*  A shard of a cache: the lock of its misses, the clock of its uses and its\n",
+        "*  entries.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    long              lock;\n",
+        "    long              clock;\n",
+        "    bin2c_cache_entry entries[BIN2C_CACHE_WAYS];\n",
+        "} bin2c_cache_shard;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache type\n",
+        "*\n",
+        "*  A cache: its budget in bytes, which the program may change before first use,\n",
+        "*  the number of bytes of decoded data that it holds, and its shards (\"NULL\"\n",
+        "*  until first use).\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    size_t              budget;\n",
+        "    size_t              used;\n",
+        "    bin2c_cache_shard * shards;\n",
+        "} bin2c_cache;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_span type\n",
+        "*\n",
+        "*  An input file's decoded data, and what holds it: a pinned entry, memory of\n",
+        "*  its own, or neither (when the data is the array itself).  The data is \"NULL\"\n",
+        "*  when decoding failed.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * data;\n",
+        "    size_t                size;\n",
+        "    bin2c_cache_entry *   entry;\n",
+        "    void *                owned;\n",
+        "} bin2c_cache_span;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_wrap function\n",
+        "*\n",
+        "*  Returns a span of the \"size\" bytes at \"data\", which need no decoding.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API bin2c_cache_span bin2c_cache_wrap ( unsigned char const * data, size_t size )\n",
+        "{\n",
+        "    bin2c_cache_span span;\n",
+        "\n",
+        "    span.data =  data;\n",
+        "    span.size =  size;\n",
+        "    span.entry = NULL;\n",
+        "    span.owned = NULL;\n",
+        "\n",
+        "    return ( span );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_release function\n",
+        "*\n",
+        "*  Releases \"span\", whose data no pointer may refer to anymore.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API void bin2c_cache_release ( bin2c_cache_span * span )\n",
+        "{\n",
+        "    if ( span->entry != NULL )\n",
+        "    {\n",
+        "        BIN2C_CACHE_ADD ( &span->entry->pins, -1l );\n",
+        "    }\n",
+        "\n",
+        "    free ( span->owned );\n",
+        "\n",
+        "    span->data =  NULL;\n",
+        "    span->size =  0;\n",
+        "    span->entry = NULL;\n",
+        "    span->owned = NULL;\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_pin function\n",
+        "*\n",
+        "*  Pins \"entry\", unless a miss or an eviction changes it.  Returns zero when\n",
+        "*  the entry was not pinned.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API int bin2c_cache_pin ( bin2c_cache_entry * entry )\n",
+        "{\n",
+        "    long pins;\n",
+        "\n",
+        "    do\n",
+        "    {\n",
+        "        pins = BIN2C_CACHE_LOAD ( &entry->pins );\n",
+        "\n",
+        "        if ( pins < 0 )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "    }\n",
+        "    while ( BIN2C_CACHE_SWAP ( &entry->pins, pins, pins + 1l ) != pins );\n",
+        "\n",
+        "    return ( 1 );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_find function\n",
+        "*\n",
+        "*  Returns the pinned entry of \"key\" in \"shard\", or \"NULL\" when the shard does\n",
+        "*  not hold its data.  Takes no lock.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API bin2c_cache_entry * bin2c_cache_find ( bin2c_cache_shard * shard, char const * key, unsigned long hash )\n",
+        "{\n",
+        "    unsigned int way;\n",
+        "\n",
+        "    for ( way = 0; way < BIN2C_CACHE_WAYS; way += 1u )\n",
+        "    {\n",
+        "        bin2c_cache_entry * entry;\n",
+        "\n",
+        "        entry = shard->entries + way;\n",
+        "\n",
+        "        if ( ( BIN2C_CACHE_LOAD ( &entry->tag ) == BIN2C_CACHE_TAG ( hash ) ) && bin2c_cache_pin ( entry ) )\n",
+        "        {\n",
+        "            if ( ( entry->data != NULL ) && ( strcmp ( entry->key, key ) == 0 ) )\n",
+        "            {\n",
+        "                BIN2C_CACHE_STORE ( &entry->stamp, BIN2C_CACHE_ADD ( &shard->clock, 1l ) );\n",
+        "\n",
+        "                return ( entry );\n",
+        "            }\n",
+        "\n",
+        "            BIN2C_CACHE_ADD ( &entry->pins, -1l );\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( NULL );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_discard function\n",
+        "*\n",
+        "*  Evicts the data of \"entry\", which the caller changes (i.e.: its pins are\n",
+        "*  -1), and gives its memory back to the system until the entry's next use.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API void bin2c_cache_discard ( bin2c_cache * cache, bin2c_cache_entry * entry )\n",
+        "{\n",
+        "    if ( entry->data != NULL )\n",
+        "    {\n",
+        "        BIN2C_CACHE_ADDSIZE ( &cache->used, ( size_t ) 0 - entry->size );\n",
+        "    }\n",
+        "\n",
+        "#if defined ( BIN2C_CACHE_WINDOWS )\n",
+        "    if ( ( entry->data != NULL ) && ( entry->capacity > 0 ) )\n",
+        "    {\n",
+        "        VirtualAlloc ( entry->base, entry->capacity, MEM_RESET, PAGE_READWRITE );\n",
+        "    }\n",
+        "#elif defined ( BIN2C_CACHE_POSIX )\n",
+        "    if ( ( entry->data != NULL ) && ( entry->capacity > 0 ) )\n",
+        "    {\n",
+        "#if defined ( MADV_FREE )\n",
+        "        madvise ( entry->base, entry->capacity, MADV_FREE );\n",
+        "#else\n",
+        "        madvise ( entry->base, entry->capacity, MADV_DONTNEED );\n",
+        "#endif\n",
+        "    }\n",
+        "#else\n",
+        "    free ( entry->base );\n",
+        "\n",
+        "    entry->base =     NULL;\n",
+        "    entry->capacity = 0;\n",
+        "#endif\n",
+        "\n",
+        "    BIN2C_CACHE_STORE ( &entry->tag, 0l );\n",
+        "\n",
+        "    entry->key =  NULL;\n",
+        "    entry->data = NULL;\n",
+        "    entry->size = 0;\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_reserve function\n",
+        "*\n",
+        "*  Makes the memory of \"entry\", which the caller changes, hold at least \"size\"\n",
+        "*  bytes.  Returns zero when the memory cannot be allocated.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API int bin2c_cache_reserve ( bin2c_cache_entry * entry, size_t size )\n",
+        "{\n",
+        "    if ( ( entry->base != NULL ) && ( entry->capacity >= size ) )\n",
+        "    {\n",
+        "        return ( 1 );\n",
+        "    }\n",
+        "\n",
+        "#if defined ( BIN2C_CACHE_WINDOWS )\n",
+        "    if ( entry->base != NULL )\n",
+        "    {\n",
+        "        VirtualFree ( entry->base, 0, MEM_RELEASE );\n",
+        "    }\n",
+        "\n",
+        "    entry->base = VirtualAlloc ( NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE );\n",
+        "#elif defined ( BIN2C_CACHE_POSIX )\n",
+        "    if ( entry->base != NULL )\n",
+        "    {\n",
+        "        munmap ( entry->base, entry->capacity );\n",
+        "    }\n",
+        "\n",
+        "    entry->base = mmap ( NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );\n",
+        "    entry->base = ( entry->base != MAP_FAILED ) ? entry->base : NULL;\n",
+        "#else\n",
+        "    free ( entry->base );\n",
+        "\n",
+        "    entry->base = malloc ( size );\n",
+        "#endif\n",
+        "\n",
+        "    entry->capacity = ( entry->base != NULL ) ? size : 0;\n",
+        "\n",
+        "    return ( entry->base != NULL );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_fits function\n",
+        "*\n",
+        "*  Returns non-zero when \"size\" more bytes of decoded data fit in the budget of\n",
+        "*  \"cache\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API int bin2c_cache_fits ( bin2c_cache * cache, size_t size )\n",
+        "{\n",
+        "    size_t used;\n",
+        "\n",
+        "    used = BIN2C_CACHE_LOADSIZE ( &cache->used );\n",
+        "\n",
+        "    return ( ( used <= cache->budget ) && ( size <= ( cache->budget - used ) ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_shards function\n",
+        "*\n",
+        "*  Returns the shards of \"cache\", which the first call allocates, or \"NULL\"\n",
+        "*  when they cannot be allocated (which a later call retries).\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API bin2c_cache_shard * bin2c_cache_shards ( bin2c_cache * cache )\n",
+        "{\n",
+        "    bin2c_cache_shard * shards;\n",
+        "\n",
+        "    shards = ( bin2c_cache_shard * ) BIN2C_CACHE_LOADSHARDS ( &cache->shards );\n",
+        "\n",
+        "    if ( shards == NULL )\n",
+        "    {\n",
+        "        bin2c_cache_shard * fresh;\n",
+        "\n",
+        "        fresh = ( bin2c_cache_shard * ) calloc ( BIN2C_CACHE_SHARDS, sizeof ( *fresh ) );\n",
+        "\n",
+        "        if ( fresh != NULL )\n",
+        "        {\n",
+        "            shards = ( bin2c_cache_shard * ) BIN2C_CACHE_PUBLISH ( &cache->shards, fresh );\n",
+        "\n",
+        "            if ( shards != NULL )\n",
+        "            {\n",
+        "                free ( fresh );\n",
+        "            }\n",
+        "            else\n",
+        "            {\n",
+        "                shards = fresh;\n",
+        "            }\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( shards );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_evict function\n",
+        "*\n",
+        "*  Claims the least recently used entry of \"shard\" that no span uses, evicting\n",
+        "*  its data, or an empty entry when \"empty\" is non-zero and the shard has one.\n",
+        "*  Returns the claimed entry, which the caller changes and must unclaim, or\n",
+        "*  \"NULL\" when every entry is in use.  The caller holds the shard's lock.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API bin2c_cache_entry * bin2c_cache_evict ( bin2c_cache * cache, bin2c_cache_shard * shard, int empty )\n",
+        "{\n",
+        "    unsigned int attempt;\n",
+        "\n",
+        "    for ( attempt = 0; attempt < BIN2C_CACHE_WAYS; attempt += 1u )\n",
+        "    {\n",
+        "        bin2c_cache_entry * victim;\n",
+        "        unsigned long       oldest;\n",
+        "        long                clock;\n",
+        "        unsigned int        way;\n",
+        "\n",
+        "        victim = NULL;\n",
+        "        oldest = 0;\n",
+        "        clock =  BIN2C_CACHE_LOAD ( &shard->clock );\n",
+        "\n",
+        "        for ( way = 0; way < BIN2C_CACHE_WAYS; way += 1u )\n",
+        "        {\n",
+        "            bin2c_cache_entry * entry;\n",
+        "            unsigned long       age;\n",
+        "\n",
+        "            entry = shard->entries + way;\n",
+        "\n",
+        "            if ( BIN2C_CACHE_LOAD ( &entry->pins ) != 0 )\n",
+        "            {\n",
+        "                continue;\n",
+        "            }\n",
+        "\n",
+        "            if ( BIN2C_CACHE_LOAD ( &entry->tag ) == 0 )\n",
+        "            {\n",
+        "                if ( empty )\n",
+        "                {\n",
+        "                    victim = entry;\n",
+        "                    break;\n",
+        "                }\n",
+        "\n",
+        "                continue;\n",
+        "            }\n",
+        "\n",
+        "            age = ( unsigned long ) clock - ( unsigned long ) BIN2C_CACHE_LOAD ( &entry->stamp );\n",
+        "\n",
+        "            if ( ( victim == NULL ) || ( age > oldest ) )\n",
+        "            {\n",
+        "                victim = entry;\n",
+        "                oldest = age;\n",
+        "            }\n",
+        "        }\n",
+        "\n",
+        "        if ( victim == NULL )\n",
+        "        {\n",
+        "            return ( NULL );\n",
+        "        }\n",
+        "\n",
+        "        if ( BIN2C_CACHE_SWAP ( &victim->pins, 0l, -1l ) == 0l )\n",
+        "        {\n",
+        "            bin2c_cache_discard ( cache, victim );\n",
+        "\n",
+        "            return ( victim );\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( NULL );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_shrink function\n",
+        "*\n",
+        "*  Evicts the least recently used data of \"shard\" that no span uses until\n",
+        "*  \"size\" more bytes of decoded data fit in the budget of \"cache\", or until no\n",
+        "*  such data is left.  The caller holds the shard's lock.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API void bin2c_cache_shrink ( bin2c_cache * cache, bin2c_cache_shard * shard, size_t size )\n",
+        "{\n",
+        "    while ( !bin2c_cache_fits ( cache, size ) )\n",
+        "    {\n",
+        "        bin2c_cache_entry * victim;\n",
+        "\n",
+        "        victim = bin2c_cache_evict ( cache, shard, 0 );\n",
+        "\n",
+        "        if ( victim == NULL )\n",
+        "        {\n",
+        "            break;\n",
+        "        }\n",
+        "\n",
+        "        BIN2C_CACHE_STORE ( &victim->pins, 0l );\n",
+        "    }\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_spill function\n",
+        "*\n",
+        "*  Evicts data of the shards of \"cache\" other than \"own\" (whose lock the caller\n",
+        "*  holds) until \"size\" more bytes of decoded data fit in the budget, since the\n",
+        "*  budget is the whole cache's.  A shard whose lock is taken is skipped rather\n",
+        "*  than waited for, so that two misses never wait for each other's shard.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API void bin2c_cache_spill ( bin2c_cache * cache, bin2c_cache_shard * shards, bin2c_cache_shard * own, size_t size )\n",
+        "{\n",
+        "    unsigned int index;\n",
+        "\n",
+        "    for ( index = 1u; ( index < BIN2C_CACHE_SHARDS ) && !bin2c_cache_fits ( cache, size ); index += 1u )\n",
+        "    {\n",
+        "        bin2c_cache_shard * shard;\n",
+        "\n",
+        "        shard = shards + ( ( ( unsigned int ) ( own - shards ) + index ) % BIN2C_CACHE_SHARDS );\n",
+        "\n",
+        "        if ( BIN2C_CACHE_SWAP ( &shard->lock, 0l, 1l ) == 0l )\n",
+        "        {\n",
+        "            bin2c_cache_shrink ( cache, shard, size );\n",
+        "\n",
+        "            BIN2C_CACHE_STORE ( &shard->lock, 0l );\n",
+        "        }\n",
+        "    }\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_cache_get function\n",
+        "*\n",
+        "*  Returns the decoded data of the input file that \"key\" names, whose hash is\n",
+        "*  \"hash\" and whose decoded size is \"size\", which \"decode\" decodes on a miss.\n",
+        "*  The span must be released with \"bin2c_cache_release\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_CACHE_API bin2c_cache_span bin2c_cache_get ( bin2c_cache * cache, char const * key, unsigned long hash, size_t size, bin2c_cache_decoder decode )\n",
+        "{\n",
+        "    static unsigned char const empty[1] = { 0 };\n",
+        "\n",
+        "    bin2c_cache_span    span;\n",
+        "    bin2c_cache_shard * shards;\n",
+        "    bin2c_cache_shard * shard;\n",
+        "    bin2c_cache_entry * entry;\n",
+        "\n",
+        "    span = bin2c_cache_wrap ( NULL, 0 );\n",
+        "\n",
+        "    if ( size == 0 )\n",
+        "    {\n",
+        "        return ( ( decode ( NULL, 0 ) == 0 ) ? bin2c_cache_wrap ( empty, 0 ) : span );\n",
+        "    }\n",
+        "\n",
+        "    shards = bin2c_cache_shards ( cache );\n",
+        "    shard =  ( shards != NULL ) ? ( shards + ( hash % BIN2C_CACHE_SHARDS ) ) : NULL;\n",
+        "    entry = ( shard != NULL ) ? bin2c_cache_find ( shard, key, hash ) : NULL;\n",
+        "\n",
+        "    /*\n",
+        "    ** A miss evicts the least recently used data until the decoded data fits\n",
+        "    *  in the budget, from its shard and then from the others, and decodes into\n",
+        "    *  an empty entry (or the least recently used one, when the shard has no\n",
+        "    *  empty entry).\n",
+        "    */\n",
+        "\n",
+        "    if ( ( entry == NULL ) && ( shard != NULL ) )\n",
+        "    {\n",
+        "        while ( BIN2C_CACHE_SWAP ( &shard->lock, 0l, 1l ) != 0l )\n",
+        "        {\n",
+        "            BIN2C_CACHE_YIELD ( );\n",
+        "        }\n",
+        "\n",
+        "        entry = bin2c_cache_find ( shard, key, hash );\n",
+        "\n",
+        "        if ( entry == NULL )\n",
+        "        {\n",
+        "            bin2c_cache_shrink ( cache, shard, size );\n",
+        "            bin2c_cache_spill ( cache, shards, shard, size );\n",
+        "        }\n",
+        "\n",
+        "        if ( ( entry == NULL ) && bin2c_cache_fits ( cache, size ) )\n",
+        "        {\n",
+        "            entry = bin2c_cache_evict ( cache, shard, 1 );\n",
+        "\n",
+        "            if ( entry != NULL )\n",
+        "            {\n",
+        "                if ( bin2c_cache_reserve ( entry, size ) && ( decode ( ( unsigned char * ) entry->base, size ) == size ) )\n",
+        "                {\n",
+        "                    BIN2C_CACHE_ADDSIZE ( &cache->used, size );\n",
+        "\n",
+        "                    entry->key =  key;\n",
+        "                    entry->data = ( unsigned char * ) entry->base;\n",
+        "                    entry->size = size;\n",
+        "\n",
+        "                    BIN2C_CACHE_STORE ( &entry->stamp, BIN2C_CACHE_ADD ( &shard->clock, 1l ) );\n",
+        "                    BIN2C_CACHE_STORE ( &entry->tag, BIN2C_CACHE_TAG ( hash ) );\n",
+        "                    BIN2C_CACHE_STORE ( &entry->pins, 1l );\n",
+        "                }\n",
+        "                else\n",
+        "                {\n",
+        "                    BIN2C_CACHE_STORE ( &entry->pins, 0l );\n",
+        "\n",
+        "                    entry = NULL;\n",
+        "                }\n",
+        "            }\n",
+        "        }\n",
+        "\n",
+        "        BIN2C_CACHE_STORE ( &shard->lock, 0l );\n",
+        "    }\n",
+        "\n",
+        "    if ( entry != NULL )\n",
+        "    {\n",
+        "        span.data =  entry->data;\n",
+        "        span.size =  entry->size;\n",
+        "        span.entry = entry;\n",
+        "    }\n",
+        "    else\n",
+        "    {\n",
+        "        span.owned = malloc ( size );\n",
+        "\n",
+        "        if ( ( span.owned != NULL ) && ( decode ( ( unsigned char * ) span.owned, size ) == size ) )\n",
+        "        {\n",
+        "            span.data = ( unsigned char const * ) span.owned;\n",
+        "            span.size = size;\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            bin2c_cache_release ( &span );\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( span );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_cache.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runcache function
+*
+*  This function outputs the C files of the decompression cache of the "-q"
+*  option, "<cache>.h" and "<cache>.c", which declare and define the cache that
+*  the "_cached" functions of all output header files share.
+*
+*  Parameter(s)
+*
+*  inpath:     pointer to the pathname of the first input binary file, whose
+*              directory receives the C files
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the output files have the cache
+*
+*  Remarks
+*
+*  The cache's budget is "MAIN_CACHEBUDGET" bytes, unless a macro of the
+*  cache's capitalized name and "_BUDGET" says otherwise when the source file
+*  compiles, or the program changes the cache's "budget" member before first
+*  use.
+*/
+
+static bool main_runcache
+(
+    char const * restrict           inpath,
+    main_arguments const * restrict arguments
+)
+{
+    bool            success;
+    char * restrict outpath;
+    char * restrict macro;
+    FILE * restrict outfile;
+
+    outfile = NULL;
+
+    outpath = main_constructsharedpath ( inpath,
+                                         arguments->cache );
+    macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                             arguments->cache,
+                                             "_BUDGET" );
+    success = ( outpath != NULL ) && ( macro != NULL );
+
+    if ( success )
+    {
+        outpath[strlen ( outpath ) - 1u] = 'h';
+
+        outfile = tmpfile ( );
+        success = outfile != NULL;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( arguments->cache,
+                                              outfile );
+
+        error =    fputs ( "#include \"bin2c_cache.h\"\n\n#if defined ( __cplusplus )\nextern \"C\"\n{\n#endif\n\nextern bin2c_cache ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->cache,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fputs ( ";\n\n#if defined ( __cplusplus )\n}\n#endif\n\n#endif\n",
+                           outfile );
+        success &= error >= 0;
+
+        error =    fflush ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        fclose ( outfile );
+    }
+
+    if ( success )
+    {
+        outpath[strlen ( outpath ) - 1u] = 'c';
+
+        outfile = tmpfile ( );
+        success = outfile != NULL;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fprintf ( outfile,
+                            "#include \"%s.h\"\n\n#if !defined ( %s )\n#define %s  %luu\n#endif\n\nbin2c_cache ",
+                            arguments->cache,
+                            macro,
+                            macro,
+                            ( unsigned long ) MAIN_CACHEBUDGET );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->cache,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             " = { %s, 0, NULL };\n",
+                             macro );
+        success &= error >= 0;
+
+        error =    fflush ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        fclose ( outfile );
+    }
+
+    if ( success )
+    {
+        success = main_runcache_outputcacher ( outpath );
+    }
+
+    if ( macro != NULL )
+    {
+        free ( macro );
+    }
+
+    if ( outpath != NULL )
+    {
+        free ( outpath );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runchunks_outputreassembler function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_pool.h", that holds the functions that reassemble the
+*  data of the pooled input binary files of the "-y" option, next to the output
+*  C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runchunks_outputreassembler
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c pool reassembler\n",
+        "*\n",
+        "*  This header file accompanies the output header files of bin2c's \"-y\" option\n",
+        "*  for the input files that share chunks of their data with other input files.\n",
+        "*  Instead of an array, each of them has a chunk table of \"unsigned long\"\n",
+        "*  pairs: the offset of a chunk in the shared pool and the chunk's size, in the\n",
+        "*  order of the file's data (with chunks that are adjacent in the pool merged\n",
+        "*  into one).  The functions find a file in place, when its data is a single\n",
+        "*  chunk of the pool, or copy it out of the pool.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_POOL_H__ )\n",
+        "\n",
+        "#define __BIN2C_POOL_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_POOL_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_POOL_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_POOL_API  static\n",
+        "#endif\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pool_span function\n",
+        "*\n",
+        "*  Returns a pointer to the data of a file in \"pool\", given the file's chunk\n",
+        "*  table \"chunks\" of \"count\" elements (i.e.: twice the number of chunks), when\n",
+        "*  the data is a single chunk, or \"NULL\" when \"bin2c_pool_copy\" must assemble\n",
+        "*  the data instead.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_POOL_API unsigned char const * bin2c_pool_span ( unsigned char const * pool, unsigned long const * chunks, size_t count )\n",
+        "{\n",
+        "    return ( ( count == 2u ) ? ( pool + chunks[0] ) : NULL );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pool_copy function\n",
+        "*\n",
+        "*  Copies the data of a file out of \"pool\" into \"dst\", which must have room for\n",
+        "*  all of it, given the file's chunk table \"chunks\" of \"count\" elements (i.e.:\n",
+        "*  twice the number of chunks).  Returns the number of bytes copied.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_POOL_API size_t bin2c_pool_copy ( unsigned char const * pool, unsigned long const * chunks, size_t count, unsigned char * dst )\n",
+        "{\n",
+        "    size_t done;\n",
+        "    size_t index;\n",
+        "\n",
+        "    done = 0;\n",
+        "\n",
+        "    for ( index = 0; ( index + 1u ) < count; index += 2u )\n",
+        "    {\n",
+        "        memcpy ( dst + done, pool + chunks[index], chunks[index + 1u] );\n",
+        "        done += chunks[index + 1u];\n",
+        "    }\n",
+        "\n",
+        "    return ( done );\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_pool.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runchunks function
+*
+*  This function outputs the chunk table of an input binary file that shares
+*  chunks of its data with other input binary files, with the "-y" option,
+*  instead of an array.
+*
+*  Parameter(s)
+*
+*  symbol:     pointer to the name of the input binary file, as "main_runbin2c"
+*              receives it
+*  arguments:  pointer to the parameters of the command-line options
+*  table:      pointer to the chunk table, which has a pair of elements per
+*              chunk: its offset in the shared pool and its size
+*  count:      the number of elements of the chunk table
+*  size:       the size of the input binary file in bytes
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the output header file has the chunk table
+*
+*  Remarks
+*
+*  The header file includes the shared pool's header file and "bin2c_pool.h",
+*  and defines the chunk table with static scope, given that it is small, and a
+*  macro for the size of the data, named like a "-g" option's macro with the
+*  "_pooled" suffix.  The chunk table's name has the "_chunks" suffix instead
+*  of the "-s" option's suffix.
+*/
+
+static bool main_runchunks
+(
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    unsigned long const * restrict  table,
+    unsigned long                   count,
+    unsigned long                   size,
+    char * restrict                 outpath
+)
+{
+    bool            success;
+    FILE * restrict outfile;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    outfile = tmpfile ( );
+    success = outfile != NULL;
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        error =    fprintf ( outfile,
+                             "#include \"bin2c_pool.h\"\n#include \"%s.h\"\n\n",
+                             arguments->pool );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        char * restrict macro;
+
+        macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                 symbol,
+                                                 "_pooled" );
+        success = macro != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#define %s  %luul\n\n",
+                                macro,
+                                size );
+            success = error >= 0;
+
+            free ( macro );
+
+        }
+
+    }
+
+    if ( success )
+    {
+        unsigned long index;
+        int           error;
+
+        error =    fputs ( "static unsigned long const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_chunks",
+                                                outfile );
+
+        error =    fputs ( "[] =\n{",
+                           outfile );
+        success &= error >= 0;
+
+        for ( index = 0; success && ( index < count ); index += 1u )
+        {
+            error =    fprintf ( outfile,
+                                 ( ( index % 8u ) == 0 ) ? "%s\n    %luul" : "%s %luul",
+                                 ( index > 0 ) ? "," : "",
+                                 table[index] );
+            success &= error >= 0;
+        }
+
+        error =    fputs ( "\n};\n\n#endif\n",
+                           outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runchunks_outputreassembler ( outpath );
+    }
+
+    if ( !success )
+    {
+        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runconstexpr function
+*
+*  This function outputs the header file of an input binary file in the
+*  "constexpr" form of the "-m" option, which is a C++17 "std::array" of 64-bit
+*  words that constant evaluation handles efficiently, instead of an array of
+*  bytes.
+*
+*  Parameter(s)
+*
+*  infile:     pointer to the "FILE" object for the input binary file
+*  symbol:     pointer to the name of the input binary file, as "main_runbin2c"
+*              receives it
+*  arguments:  pointer to the parameters of the command-line options
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output header file has the array
+*
+*  Remarks
+*
+*  Every word holds eight bytes of the data, the first one in its least
+*  significant bits, and the last word's missing bytes are zero.  Eight times
+*  fewer elements make the initializer that much quicker to parse and keep
+*  constant evaluation within the compilers' limits on the number of
+*  operations.  The array is "inline constexpr", so it has a single definition
+*  like the "inline" form's, and is usable in "static_assert" declarations
+*  and "consteval" functions.  The header file also defines the size of the
+*  data with the "_size" suffix (instead of the "-s" option's suffix) and two
+*  "constexpr" accessors: the byte at an offset, with the "_byte" suffix, and
+*  the word of the eight bytes from an offset, with the "_word" suffix.  The
+*  "-b" option wraps the initializer after as many words as hold that many
+*  bytes, and the "-n" option's comments state the offsets in bytes.
+*/
+
+static bool main_runconstexpr
+(
+    FILE * restrict                 infile,
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    char * restrict                 outpath
+)
+{
+    bool                     success;
+    FILE * restrict          outfile;
+    unsigned char * restrict buffer;
+    char * restrict          base;
+    char * restrict          array;
+    unsigned long            size;
+    unsigned long            count;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    size =  0;
+    count = 0;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( ( MAIN_CHUNKSIZE % 8u ) == 0 );
+
+    buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    base =    main_constructname ( arguments->prefix,
+                                   symbol,
+                                   NULL );
+    array =   main_constructname ( arguments->prefix,
+                                   symbol,
+                                   arguments->suffix );
+    outfile = tmpfile ( );
+    success = ( buffer != NULL ) && ( base != NULL ) && ( array != NULL ) && ( outfile != NULL );
+
+    /*
+    ** The array's type states the number of words, so the size of the data
+    *  must be known before the initializer.
+    */
+
+    if ( success )
+    {
+        long end;
+
+        success = fseek ( infile,
+                          0l,
+                          SEEK_END ) == 0;
+        end =     success ? ftell ( infile ) : -1l;
+        success = end >= 0;
+
+        if ( success )
+        {
+            size =     ( unsigned long ) end;
+            success &= arguments->padsize <= ( ULONG_MAX - size - 7u );
+            success &= size <= ( ULONG_MAX - 7u );
+        }
+
+        if ( success )
+        {
+            count = ( size + arguments->padsize + 7u ) / 8u;
+        }
+
+        rewind ( infile );
+    }
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        error =    fputs ( "#if !( ( defined ( __cplusplus ) && ( __cplusplus >= 201703l ) ) || ( defined ( _MSVC_LANG ) && ( _MSVC_LANG >= 201703l ) ) )\n"  \
+                           "#error \"This header file needs C++17 or later.\"\n"                                                                             \
+                           "#endif\n\n#include <array>\n#include <cstddef>\n#include <cstdint>\n\n",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputplacement ( arguments,
+                                                   true,
+                                                   outfile );
+
+        error =    fprintf ( outfile,
+                             "inline constexpr std::array<std::uint64_t, %luu> %s =%s",
+                             count,
+                             array,
+                             ( arguments->lines != NULL ) ? "\n{ {\n" : " { { " );
+        success &= error >= 0;
+
+    }
+
+    /*
+    ** The words are hexadecimal literals of two 32-bit halves, given that an
+    *  "unsigned long" may not have more bits than that.
+    */
+
+    if ( success )
+    {
+        unsigned long perline;
+        unsigned long word;
+        size_t        available;
+        size_t        position;
+
+        perline =   ( arguments->lines != NULL ) ? ( ( arguments->linesize + 7u ) / 8u ) : 0;
+        available = 0;
+        position =  0;
+
+        for ( word = 0; success && ( word < count ); word += 1u )
+        {
+            unsigned long halves[2];
+            unsigned int  index;
+            int           error;
+
+            halves[0] = 0;
+            halves[1] = 0;
+
+            for ( index = 0; index < 8u; index += 1u )
+            {
+                if ( ( position == available ) && !feof ( infile ) )
+                {
+                    available = fread ( buffer,
+                                        sizeof ( *buffer ),
+                                        MAIN_CHUNKSIZE,
+                                        infile );
+                    position =  0;
+                    success &=  ferror ( infile ) == 0;
+                }
+
+                if ( position < available )
+                {
+                    halves[index / 4u] |= ( unsigned long ) buffer[position] << ( ( index % 4u ) * 8u );
+                    position +=           1u;
+                }
+            }
+
+            if ( ( perline > 0 ) && ( ( word % perline ) == 0 ) )
+            {
+                error =    fputs ( ( word > 0 ) ? ",\n" : "",
+                                   outfile );
+                success &= error >= 0;
+
+                if ( ( arguments->marks != NULL ) && ( ( ( word / perline ) % arguments->marksize ) == 0 ) )
+                {
+                    error =    fprintf ( outfile,
+                                         "    /* 0x%08lX */\n",
+                                         word * 8u );
+                    success &= error >= 0;
+                }
+
+                error =    fputs ( "    ",
+                                   outfile );
+                success &= error >= 0;
+            }
+            else if ( word > 0 )
+            {
+                error =    fputs ( ", ",
+                                   outfile );
+                success &= error >= 0;
+            }
+
+            error =    fprintf ( outfile,
+                                 "0x%08lX%08lXull",
+                                 halves[1],
+                                 halves[0] );
+            success &= error >= 0;
+        }
+    }
+
+    /*
+    ** The accessors only use what C++14 allows in "constexpr" functions, and
+    *  read past the last word as zero bytes.
+    */
+
+    if ( success )
+    {
+        int error;
+
+        error =    fprintf ( outfile,
+                             "%s\ninline constexpr std::size_t %s_size = %luu;\n\n",
+                             ( arguments->lines != NULL ) ? "\n} };\n" : " } };\n",
+                             base,
+                             size );
+        success &= error >= 0;
+
+        error =    fprintf ( outfile,
+                             "constexpr unsigned char %s_byte ( std::size_t offset )\n{\n"                                                     \
+                             "    return ( static_cast<unsigned char> ( ( %s[offset / 8u] >> ( ( offset %% 8u ) * 8u ) ) & 0xFFu ) );\n}\n\n",
+                             base,
+                             array );
+        success &= error >= 0;
+
+        error =    fprintf ( outfile,
+                             "constexpr std::uint64_t %s_word ( std::size_t offset )\n{\n"                                        \
+                             "    std::uint64_t const low = %s[offset / 8u] >> ( ( offset %% 8u ) * 8u );\n",
+                             base,
+                             array );
+        success &= error >= 0;
+
+        error =    fprintf ( outfile,
+                             "    std::uint64_t const high = ( ( ( offset %% 8u ) != 0 ) && ( ( ( offset / 8u ) + 1u ) < %s.size ( ) ) ) ? ( %s[( offset / 8u ) + 1u] << ( 64u - ( ( offset %% 8u ) * 8u ) ) ) : 0u;\n\n"  \
+                             "    return ( low | high );\n}\n\n#endif\n",
+                             array,
+                             array );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( array != NULL )
+    {
+        free ( array );
+    }
+
+    if ( base != NULL )
+    {
+        free ( base );
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    if ( !success )
+    {
+        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runtyped_format function
+*
+*  This function converts an element of the input binary file into the text of
+*  its initializer value in a typed array, with the "-t" option.
+*
+*  Parameter(s)
+*
+*  data:       pointer to the element's bytes, in the input binary file's byte
+*              order
+*  element:    pointer to the type of the element
+*  bigendian:  whether the element is big-endian (as opposed to little-endian)
+*  text:       pointer to the buffer that receives the null-terminated text;
+*              must have room for "MAIN_TYPEDSIZE" characters
+*
+*  Remarks
+*
+*  The value is assembled from the bytes in the given byte order, so the text
+*  is the same whichever byte order the machines that run this program and that
+*  compile its output have.  An "unsigned long" holds 32 bits of the value at a
+*  time.  Integers are hexadecimal literals with the type's suffix, and negative
+*  ones have a minus sign (the minimum, whose magnitude is out of range, is a
+*  subtraction instead).  Floating-point numbers are hexadecimal floating-point
+*  literals of their exact bits, so finite values round-trip exactly, whereas
+*  infinities and NaNs are the "INFINITY" and "NAN" macros (without a NaN's
+*  payload).
+*/
+
+static void main_runtyped_format
+(
+    unsigned char const * restrict data,
+    main_type const * restrict     element,
+    bool                           bigendian,
+    char * restrict                text
+)
+{
+    unsigned long halves[2];
+    unsigned int  index;
+
+    halves[0] = 0;
+    halves[1] = 0;
+
+    for ( index = 0; index < element->size; index += 1u )
+    {
+        unsigned char value;
+
+        value =              data[bigendian ? ( element->size - 1u - index ) : index];
+        halves[index / 4u] |= ( unsigned long ) value << ( ( index % 4u ) * 8u );
+    }
+
+    if ( element->kind == MAIN_KIND_FLOAT )
+    {
+        char          digits[16];
+        unsigned long exponent;
+        unsigned long maximum;
+        long          bias;
+        bool          negative;
+        bool          empty;
+        size_t        length;
+
+        /*
+        ** The fraction's hexadecimal digits are 6 for "float" (23 bits shifted
+        *  left by one) and 13 for "double" (20 bits and 32 bits).
+        */
+
+        if ( element->size == 4u )
+        {
+            negative = ( halves[0] >> 31 ) != 0;
+            exponent = ( halves[0] >> 23 ) & 0xFFu;
+            maximum =  0xFFu;
+            bias =     127l;
+            empty =    ( halves[0] & 0x7FFFFFul ) == 0;
+
+            sprintf ( digits,
+                      "%06lX",
+                      ( halves[0] & 0x7FFFFFul ) << 1 );
+        }
+        else
+        {
+            negative = ( halves[1] >> 31 ) != 0;
+            exponent = ( halves[1] >> 20 ) & 0x7FFu;
+            maximum =  0x7FFu;
+            bias =     1023l;
+            empty =    ( ( halves[1] & 0xFFFFFul ) == 0 ) && ( halves[0] == 0 );
+
+            sprintf ( digits,
+                      "%05lX%08lX",
+                      halves[1] & 0xFFFFFul,
+                      halves[0] );
+        }
+
+        length = strlen ( digits );
+
+        while ( ( length > 0 ) && ( digits[length - 1u] == '0' ) )
+        {
+            length -= 1u;
+        }
+
+        digits[length] = '\0';
+
+        if ( exponent == maximum )
+        {
+            sprintf ( text,
+                      "%s%s",
+                      negative ? "-" : "",
+                      empty ? "INFINITY" : "NAN" );
+        }
+        else
+        {
+            sprintf ( text,
+                      "%s0x%c%s%sp%+ld%s",
+                      negative ? "-" : "",
+                      ( exponent > 0 ) ? '1' : '0',
+                      ( length > 0 ) ? "." : "",
+                      digits,
+                      ( exponent > 0 ) ? ( ( long ) exponent - bias ) : ( empty ? 0l : ( 1l - bias ) ),
+                      ( element->size == 4u ) ? "f" : "" );
+        }
+    }
+    else
+    {
+        unsigned long mask;
+        unsigned long sign;
+        unsigned long high;
+        unsigned long low;
+        bool          negative;
+        bool          minimum;
+
+        mask = ( element->size < 4u ) ? ( ( 1ul << ( element->size * 8u ) ) - 1u ) : 0xFFFFFFFFul;
+        sign = ( mask >> 1 ) + 1u;
+        high = halves[1];
+        low =  halves[0];
+
+        /*
+        ** The sign bit is the top bit of the word that holds the last byte, and
+        *  a negative value's magnitude is its two's complement negation.
+        */
+
+        negative = ( element->kind == MAIN_KIND_SIGNED ) && ( ( halves[( element->size - 1u ) / 4u] & sign ) != 0 );
+
+        if ( negative )
+        {
+            low = ( ~low + 1u ) & mask;
+
+            if ( element->size == 8u )
+            {
+                high = ( ~high + ( ( low == 0 ) ? 1u : 0u ) ) & 0xFFFFFFFFul;
+            }
+        }
+
+        minimum = negative && ( ( element->size == 8u ) ? ( ( high == sign ) && ( low == 0 ) ) : ( low == sign ) );
+
+        if ( element->size == 8u )
+        {
+            char const * restrict macro;
+
+            macro = ( element->kind == MAIN_KIND_SIGNED ) ? "INT64_C" : "UINT64_C";
+
+            if ( minimum )
+            {
+                sprintf ( text,
+                          "( -%s ( 0x7FFFFFFFFFFFFFFF ) - 1 )",
+                          macro );
+            }
+            else if ( high > 0 )
+            {
+                sprintf ( text,
+                          "%s%s ( 0x%lX%08lX )",
+                          negative ? "-" : "",
+                          macro,
+                          high,
+                          low );
+            }
+            else
+            {
+                sprintf ( text,
+                          "%s%s ( 0x%lX )",
+                          negative ? "-" : "",
+                          macro,
+                          low );
+            }
+        }
+        else if ( minimum )
+        {
+            sprintf ( text,
+                      "( -0x%lX%s - 1%s )",
+                      low - 1u,
+                      element->suffix,
+                      element->suffix );
+        }
+        else
+        {
+            sprintf ( text,
+                      "%s0x%lX%s",
+                      negative ? "-" : "",
+                      low,
+                      element->suffix );
+        }
+    }
+}
+
+
+
+/*
+** main_runtyped_outputvalues function
+*
+*  This function outputs the initializer values of a typed array, with the "-t"
+*  option, and what follows them, from the records of the input binary file.
+*
+*  Parameter(s)
+*
+*  infile:      pointer to the "FILE" object for the input binary file, which
+*               this function rewinds
+*  arguments:   pointer to the parameters of the command-line options
+*  fields:      pointer to the fields of a record
+*  fieldcount:  the number of fields of a record
+*  recordsize:  the number of bytes of a record
+*  count:       the number of records
+*  column:      index of the field whose values to output (i.e.: a column of
+*               the "columns" form), or "fieldcount" for all of them
+*  outfile:     pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the array's initializer
+*
+*  Remarks
+*
+*  With a record layout, the values of all fields are the braced initializer of
+*  a structure.  (A single type is a record of one field without braces.)  The
+*  "-b" option wraps the initializer after as many records as hold that many
+*  bytes, and the "-n" option's comments state the offsets in bytes, so a
+*  column's lines match the records' lines.
+*/
+
+static bool main_runtyped_outputvalues
+(
+    FILE * restrict                 infile,
+    main_arguments const * restrict arguments,
+    main_field const * restrict     fields,
+    unsigned long                   fieldcount,
+    unsigned long                   recordsize,
+    unsigned long                   count,
+    unsigned long                   column,
+    FILE * restrict                 outfile
+)
+{
+    bool                     success;
+    unsigned char * restrict buffer;
+    unsigned char * restrict record;
+    bool                     braces;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+
+    braces = ( arguments->fields != NULL ) && ( column == fieldcount );
+
+    rewind ( infile );
+
+    buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    record =  ( unsigned char * ) malloc ( sizeof ( *record ) * ( size_t ) recordsize );
+    success = ( buffer != NULL ) && ( record != NULL );
+
+    if ( success )
+    {
+        unsigned long perline;
+        unsigned long index;
+        size_t        available;
+        size_t        position;
+
+        perline =   ( arguments->lines != NULL ) ? ( ( arguments->linesize + recordsize - 1u ) / recordsize ) : 0;
+        available = 0;
+        position =  0;
+
+        for ( index = 0; success && ( index < count ); index += 1u )
+        {
+            unsigned long byte;
+            unsigned long field;
+            int           error;
+
+            for ( byte = 0; success && ( byte < recordsize ); byte += 1u )
+            {
+                if ( position == available )
+                {
+                    available = fread ( buffer,
+                                        sizeof ( *buffer ),
+                                        MAIN_CHUNKSIZE,
+                                        infile );
+                    position =  0;
+                    success &=  available > 0;
+                }
+
+                if ( success )
+                {
+                    record[byte] = buffer[position];
+                    position +=    1u;
+                }
+            }
+
+            if ( !success )
+            {
+                break;
+            }
+
+            if ( ( perline > 0 ) && ( ( index % perline ) == 0 ) )
+            {
+                error =    fputs ( ( index > 0 ) ? ",\n" : "",
+                                   outfile );
+                success &= error >= 0;
+
+                if ( ( arguments->marks != NULL ) && ( ( ( index / perline ) % arguments->marksize ) == 0 ) )
+                {
+                    error =    fprintf ( outfile,
+                                         "    /* 0x%08lX */\n",
+                                         index * recordsize );
+                    success &= error >= 0;
+                }
+
+                error =    fputs ( "    ",
+                                   outfile );
+                success &= error >= 0;
+            }
+            else if ( index > 0 )
+            {
+                error =    fputs ( ", ",
+                                   outfile );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( braces ? "{ " : "",
+                               outfile );
+            success &= error >= 0;
+
+            for ( field = 0; field < fieldcount; field += 1u )
+            {
+                char text[MAIN_TYPEDSIZE];
+
+                if ( ( column < fieldcount ) && ( field != column ) )
+                {
+                    continue;
+                }
+
+                main_runtyped_format ( record + fields[field].offset,
+                                       fields[field].element,
+                                       fields[field].bigendian,
+                                       text );
+
+                error =    fprintf ( outfile,
+                                     "%s%s",
+                                     ( braces && ( field > 0 ) ) ? ", " : "",
+                                     text );
+                success &= error >= 0;
+            }
+
+            error =    fputs ( braces ? " }" : "",
+                               outfile );
+            success &= error >= 0;
+        }
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fputs ( ( arguments->lines != NULL ) ? "\n};\n\n" : " };\n\n",
+                          outfile );
+        success = error >= 0;
+
+    }
+
+    if ( record != NULL )
+    {
+        free ( record );
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runtyped function
+*
+*  This function outputs the header file of an input binary file as a typed
+*  array, with the "-t" option, whose elements are the input binary file's
+*  elements of the given type, or its records of the given layout, instead of
+*  its bytes.
+*
+*  Parameter(s)
+*
+*  infile:     pointer to the "FILE" object for the input binary file
+*  symbol:     pointer to the name of the input binary file, as "main_runbin2c"
+*              receives it
+*  arguments:  pointer to the parameters of the command-line options
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as the input binary file's size
+*            not being a multiple of the type's (or record's) size, and the
+*            output file likely is in an incomplete form
+*  !=false:  success; the output header file has the array(s)
+*
+*  Remarks
+*
+*  The array has static scope in the header file, like the default form's
+*  without the "-g" and "-l" options, and its type gives it the alignment that
+*  its elements need, so the program indexes it directly instead of copying
+*  elements out of an array of bytes.  The element values are converted from
+*  the input binary file's byte order while this program runs.  The integer
+*  types are the ones of "<stdint.h>", so the header file needs C99 or C++, and
+*  floating-point numbers are hexadecimal floating-point literals, which C++
+*  only has since C++17, so a header file with them needs C99 or C++17.  A record layout makes the array's
+*  elements structures, with the "_record" suffix, whose members are the
+*  fields (without the layout's padding, while the compiler pads them as their
+*  types need).  The "columns" form of the "-m" option instead transposes the
+*  records into an array per field, named after the field and suffixed with
+*  the "-s" option's suffix, which makes every column contiguous.  The input
+*  binary file is read once per column, which keeps the memory to one chunk.
+*/
+
+static bool main_runtyped
+(
+    FILE * restrict                 infile,
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    char * restrict                 outpath
+)
+{
+    bool                        success;
+    bool                        whole;
+    FILE * restrict             outfile;
+    main_field                  scalar;
+    main_field const * restrict fields;
+    unsigned long               fieldcount;
+    unsigned long               recordsize;
+    unsigned long               count;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    /*
+    ** A single type is a record of one field.
+    */
+
+    if ( arguments->fields != NULL )
+    {
+        fields =     arguments->fields;
+        fieldcount = arguments->fieldcount;
+        recordsize = arguments->recordsize;
+    }
+    else
+    {
+        scalar.name =      NULL;
+        scalar.element =   arguments->element;
+        scalar.bigendian = arguments->bigendian;
+        scalar.offset =    0;
+
+        fields =     &scalar;
+        fieldcount = 1u;
+        recordsize = arguments->element->size;
+    }
+
+    whole =   true;
+    count =   0;
+
+    outfile = tmpfile ( );
+    success = outfile != NULL;
+
+    /*
+    ** The input binary file must hold whole records, which its size tells
+    *  before anything is output.
+    */
+
+    if ( success )
+    {
+        long end;
+
+        success = fseek ( infile,
+                          0l,
+                          SEEK_END ) == 0;
+        end =     success ? ftell ( infile ) : -1l;
+        success = end >= 0;
+
+        if ( success )
+        {
+            count =   ( unsigned long ) end / recordsize;
+            whole =   ( ( unsigned long ) end % recordsize ) == 0;
+            success = whole;
+        }
+
+        rewind ( infile );
+    }
+
+    if ( success )
+    {
+        unsigned long field;
+        bool          integers;
+        bool          floats;
+        int           error;
+
+        integers = false;
+        floats =   false;
+
+        for ( field = 0; field < fieldcount; field += 1u )
+        {
+            integers |= fields[field].element->kind != MAIN_KIND_FLOAT;
+            floats |=   fields[field].element->kind == MAIN_KIND_FLOAT;
+        }
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        /*
+        ** C++ only has hexadecimal floating-point literals since C++17.
+        */
+
+        if ( floats )
+        {
+            error =    fputs ( "#if !( ( defined ( __cplusplus ) && ( ( __cplusplus >= 201703l ) || ( defined ( _MSVC_LANG ) && ( _MSVC_LANG >= 201703l ) ) ) ) || \\\n" \
+                               "       ( !defined ( __cplusplus ) && defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) ) )\n"            \
+                               "#error \"This header file needs C99 or C++17.\"\n"                                                                    \
+                               "#endif\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+        else
+        {
+            error =    fputs ( "#if !( defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) ) )\n"  \
+                               "#error \"This header file needs C99 or C++.\"\n"                                                           \
+                               "#endif\n\n",
+                               outfile );
+            success &= error >= 0;
+        }
+
+        error =    fputs ( floats ? "#include <math.h>\n" : "",
+                           outfile );
+        success &= error >= 0;
+
+        error =    fputs ( integers ? "#include <stdint.h>\n\n" : "\n",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    /*
+    ** The structure's members are aligned like the columns of a table, after
+    *  the longest type name.
+    */
+
+    if ( success && ( arguments->fields != NULL ) && ( arguments->form != MAIN_FORM_COLUMNS ) )
+    {
+        unsigned long field;
+        size_t        width;
+        int           error;
+
+        width = 0;
+
+        for ( field = 0; field < fieldcount; field += 1u )
+        {
+            if ( strlen ( fields[field].element->declared ) > width )
+            {
+                width = strlen ( fields[field].element->declared );
+            }
+        }
+
+        error =    fputs ( "typedef struct\n{\n",
+                           outfile );
+        success &= error >= 0;
+
+        for ( field = 0; field < fieldcount; field += 1u )
+        {
+            error =    fprintf ( outfile,
+                                 "    %-*s %s;\n",
+                                 ( int ) width,
+                                 fields[field].element->declared,
+                                 fields[field].name );
+            success &= error >= 0;
+        }
+
+        error =    fputs ( "} ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_record",
+                                                outfile );
+
+        error =    fputs ( ";\n\n",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    if ( success )
+    {
+        unsigned long column;
+        unsigned long columns;
+
+        column =  ( arguments->form == MAIN_FORM_COLUMNS ) ? 0 : fieldcount;
+        columns = ( arguments->form == MAIN_FORM_COLUMNS ) ? fieldcount : 1u;
+
+        for ( ; success && ( columns > 0 ); columns -= 1u )
+        {
+            int error;
+
+            success = main_runbin2c_outputplacement ( arguments,
+                                                      true,
+                                                      outfile );
+
+            error =    fputs ( "static ",
+                               outfile );
+            success &= error >= 0;
+
+            if ( column < fieldcount )
+            {
+                error =    fprintf ( outfile,
+                                     "%s const ",
+                                     fields[column].element->declared );
+                success &= error >= 0;
+
+                success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                        symbol,
+                                                        "_",
+                                                        outfile );
+
+                success &= main_runbin2c_outputsymbol ( NULL,
+                                                        fields[column].name,
+                                                        arguments->suffix,
+                                                        outfile );
+            }
+            else
+            {
+                if ( arguments->fields != NULL )
+                {
+                    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                            symbol,
+                                                            "_record",
+                                                            outfile );
+                }
+                else
+                {
+                    error =    fputs ( fields[0].element->declared,
+                                       outfile );
+                    success &= error >= 0;
+                }
+
+                error =    fputs ( " const ",
+                                   outfile );
+                success &= error >= 0;
+
+                success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                        symbol,
+                                                        arguments->suffix,
+                                                        outfile );
+            }
+
+            error =    fputs ( ( arguments->lines != NULL ) ? "[] =\n{\n" : "[] = { ",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runtyped_outputvalues ( infile,
+                                                    arguments,
+                                                    fields,
+                                                    fieldcount,
+                                                    recordsize,
+                                                    count,
+                                                    column,
+                                                    outfile );
+
+            column += 1u;
+        }
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fputs ( "#endif\n",
+                          outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( !success )
+    {
+        fputs ( whole ? "ERROR: failed to create output C file(s) from the input binary file." : "ERROR: the size of the input binary file is not a multiple of the size of its type.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runtext_escape function
+*
+*  This function converts a byte of the input text file into its text in a
+*  string literal, with the "text" and "lines" forms of the "-m" option.
+*
+*  Parameter(s)
+*
+*  byte:      the byte of the input text file
+*  question:  whether the previous byte of the same string literal is a
+*             question mark
+*  text:      pointer to the buffer that receives the null-terminated text;
+*             must have room for "MAIN_TEXTSIZE" characters
+*
+*  Remarks
+*
+*  Printable ASCII characters remain themselves, except for the quotation mark
+*  and the backslash, and the question mark after another one, which would
+*  otherwise start a trigraph.  The usual white space characters have their
+*  simple escape sequences and all other bytes have octal escape sequences of
+*  three digits, which, unlike hexadecimal ones, never absorb a digit that
+*  follows them.
+*/
+
+static void main_runtext_escape
+(
+    unsigned char   byte,
+    bool            question,
+    char * restrict text
+)
+{
+    switch ( byte )
+    {
+        case '\n':
+            strcpy ( text,
+                     "\\n" );
+            break;
+
+        case '\t':
+            strcpy ( text,
+                     "\\t" );
+            break;
+
+        case '\r':
+            strcpy ( text,
+                     "\\r" );
+            break;
+
+        case '"':
+            strcpy ( text,
+                     "\\\"" );
+            break;
+
+        case '\\':
+            strcpy ( text,
+                     "\\\\" );
+            break;
+
+        case '?':
+            strcpy ( text,
+                     question ? "\\?" : "?" );
+            break;
+
+        default:
+            if ( ( byte >= 0x20u ) && ( byte <= 0x7Eu ) )
+            {
+                text[0] = ( char ) byte;
+                text[1] = '\0';
+            }
+            else
+            {
+                sprintf ( text,
+                          "\\%03o",
+                          ( unsigned int ) byte );
+            }
+            break;
+    }
+}
+
+
+
+/*
+** main_runtext function
+*
+*  This function outputs the header file of an input text file as a string
+*  literal, with the "text" and "lines" forms of the "-m" option, instead of an
+*  array of bytes.
+*
+*  Parameter(s)
+*
+*  infile:     pointer to the "FILE" object for the input text file
+*  symbol:     pointer to the name of the input text file, as "main_runbin2c"
+*              receives it
+*  arguments:  pointer to the parameters of the command-line options
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output header file has the string
+*
+*  Remarks
+*
+*  The array of characters has static scope in the header file and holds the
+*  input text file's data with a terminating null character, so the program
+*  uses it as a C string directly.  The "_length" macro is the number of bytes
+*  without the null character (which differs from the C string's length when
+*  the data itself has null characters), and C++17 gets a "std::string_view"
+*  of the data with the "_view" suffix.  Every line of the input text file is
+*  a string literal of its own, which the compiler concatenates, and the "-b"
+*  option also splits longer lines.  Compilers limit the length of a string
+*  literal, though (e.g.: to 64 KiB in Visual C++), so large data needs the
+*  default form.  The "lines" form adds the "_lines" array of the offsets at
+*  which the lines start, and its "_LINES" macro, the number of lines, so the
+*  program finds the line of an offset with a binary search.  An empty input
+*  text file has a single, empty line.
+*/
+
+static bool main_runtext
+(
+    FILE * restrict                 infile,
+    char const * restrict           symbol,
+    main_arguments const * restrict arguments,
+    char * restrict                 outpath
+)
+{
+    bool                     success;
+    FILE * restrict          outfile;
+    unsigned char * restrict buffer;
+    unsigned long            size;
+    unsigned long            lines;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    size =  0;
+    lines = 1u;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+
+    buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    outfile = tmpfile ( );
+    success = ( buffer != NULL ) && ( outfile != NULL );
+
+    if ( success )
+    {
+        long end;
+
+        success = fseek ( infile,
+                          0l,
+                          SEEK_END ) == 0;
+        end =     success ? ftell ( infile ) : -1l;
+        success = end >= 0;
+        size =    success ? ( unsigned long ) end : 0;
+
+        rewind ( infile );
+    }
+
+    if ( success )
+    {
+        char * restrict macro;
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        macro =    main_runbin2c_constructmacro ( arguments->prefix,
+                                                  symbol,
+                                                  "_length" );
+        success &= macro != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#if ( defined ( __cplusplus ) && ( __cplusplus >= 201703l ) ) || ( defined ( _MSVC_LANG ) && ( _MSVC_LANG >= 201703l ) )\n"  \
+                                "#include <string_view>\n"                                                                                                  \
+                                "#endif\n\n#define %s  %luul\n\n",
+                                macro,
+                                size );
+            success = error >= 0;
+
+            free ( macro );
+
+        }
+
+        success &= main_runbin2c_outputplacement ( arguments,
+                                                   true,
+                                                   outfile );
+
+        {
+            int error;
+
+            error =    fputs ( "static char const ",
+                               outfile );
+            success &= error >= 0;
+
+        }
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->suffix,
+                                                outfile );
+
+        {
+            int error;
+
+            error =    fputs ( ( size > 0 ) ? "[] =\n" : "[] =\n    \"\"",
+                               outfile );
+            success &= error >= 0;
+
+        }
+    }
+
+    /*
+    ** A string literal ends after every line feed and, with the "-b" option,
+    *  after that many bytes (unless a line feed follows them).
+    */
+
+    if ( success )
+    {
+        unsigned long offset;
+        unsigned long column;
+        bool          question;
+        size_t        available;
+        size_t        position;
+
+        column =    0;
+        question =  false;
+        available = 0;
+        position =  0;
+
+        for ( offset = 0; success && ( offset < size ); offset += 1u )
+        {
+            char          text[MAIN_TEXTSIZE];
+            unsigned char byte;
+            int           error;
+
+            if ( position == available )
+            {
+                available = fread ( buffer,
+                                    sizeof ( *buffer ),
+                                    MAIN_CHUNKSIZE,
+                                    infile );
+                position =  0;
+                success &=  available > 0;
+
+                if ( !success )
+                {
+                    break;
+                }
+            }
+
+            byte =     buffer[position];
+            position += 1u;
+
+            if ( ( column > 0 ) && ( arguments->lines != NULL ) && ( column >= arguments->linesize ) && ( byte != '\n' ) )
+            {
+                error =    fputs ( "\"\n",
+                                   outfile );
+                success &= error >= 0;
+
+                column =   0;
+                question = false;
+            }
+
+            main_runtext_escape ( byte,
+                                  question,
+                                  text );
+
+            error =    fprintf ( outfile,
+                                 ( column == 0 ) ? "    \"%s" : "%s",
+                                 text );
+            success &= error >= 0;
+
+            question = byte == '?';
+            column +=  1u;
+
+            if ( byte == '\n' )
+            {
+                error =    fputs ( ( ( offset + 1u ) < size ) ? "\"\n" : "\"",
+                                   outfile );
+                success &= error >= 0;
+
+                column =   0;
+                question = false;
+                lines +=   ( ( offset + 1u ) < size ) ? 1u : 0;
+            }
+        }
+
+        if ( success )
+        {
+            int error;
+
+            error =   fputs ( ( column > 0 ) ? "\";\n\n" : ";\n\n",
+                              outfile );
+            success = error >= 0;
+
+        }
+    }
+
+    if ( success )
+    {
+        char * restrict macro;
+        int             error;
+
+        error =    fputs ( "#if ( defined ( __cplusplus ) && ( __cplusplus >= 201703l ) ) || ( defined ( _MSVC_LANG ) && ( _MSVC_LANG >= 201703l ) )\nstatic constexpr std::string_view ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_view",
+                                                outfile );
+
+        error =    fputs ( " ( ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->suffix,
+                                                outfile );
+
+        macro =    main_runbin2c_constructmacro ( arguments->prefix,
+                                                  symbol,
+                                                  "_length" );
+        success &= macro != NULL;
+
+        if ( success )
+        {
+            error =   fprintf ( outfile,
+                                ", %s );\n#endif\n\n",
+                                macro );
+            success = error >= 0;
+
+        }
+
+        if ( macro != NULL )
+        {
+            free ( macro );
+        }
+    }
+
+    /*
+    ** The offsets of the lines' starts take a second pass over the input text
+    *  file, whose number of lines the first pass counted.
+    */
+
+    if ( success && ( arguments->form == MAIN_FORM_LINES ) )
+    {
+        char * restrict macro;
+
+        macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                 symbol,
+                                                 "_lines" );
+        success = macro != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#define %s  %luul\n\nstatic unsigned long const ",
+                                macro,
+                                lines );
+            success = error >= 0;
+
+            free ( macro );
+
+        }
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                "_lines",
+                                                outfile );
+
+        if ( success )
+        {
+            int error;
+
+            error =   fputs ( "[] =\n{\n    0ul",
+                              outfile );
+            success = error >= 0;
+
+        }
+
+        rewind ( infile );
+
+        if ( success )
+        {
+            unsigned long offset;
+            unsigned long line;
+            size_t        available;
+            size_t        position;
+
+            line =      1u;
+            available = 0;
+            position =  0;
+
+            for ( offset = 0; success && ( offset < size ); offset += 1u )
+            {
+                if ( position == available )
+                {
+                    available = fread ( buffer,
+                                        sizeof ( *buffer ),
+                                        MAIN_CHUNKSIZE,
+                                        infile );
+                    position =  0;
+                    success &=  available > 0;
+
+                    if ( !success )
+                    {
+                        break;
+                    }
+                }
+
+                if ( ( buffer[position] == '\n' ) && ( ( offset + 1u ) < size ) )
+                {
+                    int error;
+
+                    error =    fprintf ( outfile,
+                                         ( ( line % 8u ) == 0 ) ? ",\n    %luul" : ", %luul",
+                                         offset + 1u );
+                    success &= error >= 0;
+
+                    line += 1u;
+                }
+
+                position += 1u;
+            }
+        }
+
+        if ( success )
+        {
+            int error;
+
+            error =   fputs ( "\n};\n\n",
+                              outfile );
+            success = error >= 0;
+
+        }
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fputs ( "#endif\n",
+                          outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    if ( !success )
+    {
+        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runalias_outputname function
+*
+*  This function outputs a macro that makes one of the names of an input binary
+*  file an alias of the same name of the input binary file it duplicates.
+*
+*  Parameter(s)
+*
+*  symbol:    pointer to the name of the duplicate input binary file
+*  original:  pointer to the name of the input binary file it duplicates
+*  prefix:    pointer to the "-p" option's prefix, or "NULL"
+*  suffix:    pointer to the suffix of the name, or "NULL"
+*  macro:     whether the name is a macro (as opposed to an identifier), which
+*             has its capitalized form
+*  outfile:   pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the macro
+*/
+
+static bool main_runalias_outputname
+(
+    char const * restrict symbol,
+    char const * restrict original,
+    char const * restrict prefix,
+    char const * restrict suffix,
+    bool                  macro,
+    FILE * restrict       outfile
+)
+{
+    bool success;
+
+    if ( macro )
+    {
+        char * restrict alias;
+        char * restrict target;
+
+        alias =    main_runbin2c_constructmacro ( prefix,
+                                                  symbol,
+                                                  suffix );
+        success =  alias != NULL;
+
+        target =   main_runbin2c_constructmacro ( prefix,
+                                                  original,
+                                                  suffix );
+        success &= target != NULL;
+
+        if ( success )
+        {
+            int error;
+
+            error =   fprintf ( outfile,
+                                "#define %s  %s\n",
+                                alias,
+                                target );
+            success = error >= 0;
+
+        }
+
+        if ( target != NULL )
+        {
+            free ( target );
+        }
+
+        if ( alias != NULL )
+        {
+            free ( alias );
+        }
+
+    }
+    else
+    {
+        int error;
+
+        error =    fputs ( "#define ",
+                           outfile );
+        success =  error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( prefix,
+                                                symbol,
+                                                suffix,
+                                                outfile );
+
+        error =    fputs ( "  ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( prefix,
+                                                original,
+                                                suffix,
+                                                outfile );
+
+        error =    fputs ( "\n",
+                           outfile );
+        success &= error >= 0;
+
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runalias function
+*
+*  This function outputs the header file of an input binary file that
+*  duplicates an earlier one, with the "-y" option, whose names are aliases of
+*  the earlier input binary file's names.
+*
+*  Parameter(s)
+*
+*  symbol:     pointer to the name of the duplicate input binary file, as
+*              "main_runbin2c" receives it
+*  original:   pointer to the name of the input binary file it duplicates
+*  arguments:  pointer to the parameters of the command-line options
+*  pooled:     whether the input binary file it duplicates has a chunk table
+*              (as opposed to an array)
+*  outpath:    pointer to the pathname for the output files, as "main_runbin2c"
+*              receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output header file has the aliases
+*
+*  Remarks
+*
+*  The header file includes the earlier input binary file's header file, which
+*  must therefore be in the same directory (or on the include path), so the
+*  data exists once, whatever the form of the output C file(s).  Only that
+*  header file's guard makes including both safe, so an input binary file of
+*  the static form, whose header file has no guard, is output in full instead.
+*
+*  The array's name is a pointer to the earlier array (so "sizeof" does not
+*  apply to it), but the other names are macros, which replace every token of
+*  that name after the header file, such as a member of a structure.
+*/
+
+static bool main_runalias
+(
+    char const * restrict           symbol,
+    char const * restrict           original,
+    main_arguments const * restrict arguments,
+    bool                            pooled,
+    char * restrict                 outpath
+)
+{
+    bool            success;
+    FILE * restrict outfile;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    outfile = tmpfile ( );
+    success = outfile != NULL;
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        error =    fprintf ( outfile,
+                             "#include \"%s.h\"\n\n",
+                             original );
+        success &= error >= 0;
+
+    }
+
+    if ( success && pooled )
+    {
+        success &= main_runalias_outputname ( symbol,
+                                              original,
+                                              arguments->prefix,
+                                              "_chunks",
+                                              false,
+                                              outfile );
+
+        success &= main_runalias_outputname ( symbol,
+                                              original,
+                                              arguments->prefix,
+                                              "_pooled",
+                                              true,
+                                              outfile );
+    }
+
+    /*
+    ** The array's name is a pointer of its own, rather than a macro, so that
+    *  it does not rename unrelated tokens (e.g.: a member of that name).
+    */
+
+    if ( success && !pooled )
+    {
+        int error;
+
+        error =    fputs ( "static unsigned char const * const ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                symbol,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fputs ( " = ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                original,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fputs ( ( ( arguments->global != NULL ) || ( arguments->extent != NULL ) || ( arguments->end != NULL ) ) ? ";\n\n" : ";\n",
+                           outfile );
+        success &= error >= 0;
+
+        if ( arguments->global != NULL )
+        {
+            success &= main_runalias_outputname ( symbol,
+                                                  original,
+                                                  arguments->prefix,
+                                                  arguments->global,
+                                                  true,
+                                                  outfile );
+        }
+
+        if ( arguments->extent != NULL )
+        {
+            success &= main_runalias_outputname ( symbol,
+                                                  original,
+                                                  arguments->prefix,
+                                                  arguments->extent,
+                                                  false,
+                                                  outfile );
+        }
+
+        if ( arguments->end != NULL )
+        {
+            success &= main_runalias_outputname ( symbol,
+                                                  original,
+                                                  arguments->prefix,
+                                                  arguments->end,
+                                                  false,
+                                                  outfile );
+        }
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fputs ( "\n#endif\n",
+                          outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( !success )
+    {
+        fputs ( "ERROR: failed to create output C file(s) from the input binary file.",
+                stderr );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputindexer function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_pack.h", that holds the functions that find an input
+*  binary file in the index of the "-u" option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runpack_outputindexer
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c pack index\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-u\" option,\n",
+        "*  which packs all input files into a single array with an index of three\n",
+        "*  arrays: the hashes of the input files' names (sorted), and the offsets of\n",
+        "*  their data in the pack and their sizes, in the same order.  The index holds\n",
+        "*  no pointers, so it needs no relocations, even in position-independent code.\n",
+        "*  The functions find an input file's index entry by its name (i.e.: its file\n",
+        "*  name, with the extension but without the path).  With the \"-i\" option, the\n",
+        "*  index instead is in the order of a minimal perfect hash, whose generated\n",
+        "*  lookup function finds an entry with one hash and one comparison of names.\n",
+        "*  With the \"-o\" option, the input files that an access trace names come first\n",
+        "*  in the pack, and a function advises the system to page them in ahead of use.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_PACK_H__ )\n",
+        "\n",
+        "#define __BIN2C_PACK_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )\n",
+        "#include <sys/mman.h>\n",
+        "#include <unistd.h>\n",
+        "#define BIN2C_PACK_POSIX\n",
+        "#endif\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_PACK_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_PACK_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_PACK_API  static\n",
+        "#endif\n",
+        "\n",
+        "#define BIN2C_PACK_NONE  ( ( size_t ) -1 )\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pack_hashn function\n",
+        "*\n",
+        "*  Returns the hash of the \"length\" characters of \"name\" that the index holds\n",
+        "*  (their 32-bit FNV-1a hash).\n",
+        "*/\n",
+        "\n",
+        "BIN2C_PACK_API unsigned long bin2c_pack_hashn ( char const * name, size_t length )\n",
+        "{\n",
+        "    unsigned long hash;\n",
+        "    size_t        index;\n",
+        "\n",
+        "    hash = 2166136261ul;\n",
+        "\n",
+        "    for ( index = 0; index < length; index += 1u )\n",
+        "    {\n",
+        "        hash ^= ( unsigned long ) ( unsigned char ) name[index];\n",
+        "        hash =  ( hash * 16777619ul ) & 0xFFFFFFFFul;\n",
+        "    }\n",
+        "\n",
+        "    return ( hash );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pack_hash function\n",
+        "*\n",
+        "*  Returns the hash of the null-terminated \"name\" that the index holds.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_PACK_API unsigned long bin2c_pack_hash ( char const * name )\n",
+        "{\n",
+        "    return ( bin2c_pack_hashn ( name, strlen ( name ) ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pack_find function\n",
+        "*\n",
+        "*  Returns the index entry of \"name\", given the hashes \"hashes\" of the \"count\"\n",
+        "*  index entries, or \"BIN2C_PACK_NONE\" when no input file had that name.  (An\n",
+        "*  unknown name may still share the hash of a known one.)\n",
+        "*/\n",
+        "\n",
+        "BIN2C_PACK_API size_t bin2c_pack_find ( unsigned long const * hashes, size_t count, char const * name )\n",
+        "{\n",
+        "    unsigned long hash;\n",
+        "    size_t        low;\n",
+        "    size_t        high;\n",
+        "\n",
+        "    hash = bin2c_pack_hash ( name );\n",
+        "    low =  0;\n",
+        "    high = count;\n",
+        "\n",
+        "    while ( low < high )\n",
+        "    {\n",
+        "        size_t middle;\n",
+        "\n",
+        "        middle = low + ( ( high - low ) / 2u );\n",
+        "\n",
+        "        if ( hashes[middle] < hash )\n",
+        "        {\n",
+        "            low = middle + 1u;\n",
+        "        }\n",
+        "        else\n",
+        "        {\n",
+        "            high = middle;\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( ( ( low < count ) && ( hashes[low] == hash ) ) ? low : BIN2C_PACK_NONE );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pack_slot function\n",
+        "*\n",
+        "*  Returns the index entry that a name's hash \"hash\" selects in an index of\n",
+        "*  \"count\" entries in the order of a minimal perfect hash, given the \"seeds\" of\n",
+        "*  its \"buckets\" buckets.  Only the name of that entry can match.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_PACK_API size_t bin2c_pack_slot ( unsigned long hash, unsigned long const * seeds, size_t buckets, size_t count )\n",
+        "{\n",
+        "    unsigned long mixed;\n",
+        "\n",
+        "    mixed =  ( hash + ( seeds[( size_t ) ( hash % buckets )] * 0x9E3779B9ul ) ) & 0xFFFFFFFFul;\n",
+        "    mixed ^= mixed >> 16;\n",
+        "    mixed =  ( mixed * 0x85EBCA6Bul ) & 0xFFFFFFFFul;\n",
+        "    mixed ^= mixed >> 13;\n",
+        "    mixed =  ( mixed * 0xC2B2AE35ul ) & 0xFFFFFFFFul;\n",
+        "    mixed ^= mixed >> 16;\n",
+        "\n",
+        "    return ( ( size_t ) ( mixed % count ) );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_pack_willneed function\n",
+        "*\n",
+        "*  Advises the system that the \"size\" bytes at \"data\" (e.g.: the hot input\n",
+        "*  files at the start of a pack) are needed soon, so that it pages them in with\n",
+        "*  a few large reads instead of a fault per page.  Does nothing on systems\n",
+        "*  without such advice.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_PACK_API void bin2c_pack_willneed ( void const * data, size_t size )\n",
+        "{\n",
+        "#if defined ( BIN2C_PACK_POSIX ) && ( defined ( POSIX_MADV_WILLNEED ) || defined ( MADV_WILLNEED ) )\n",
+        "    long   page;\n",
+        "    size_t skew;\n",
+        "\n",
+        "    page = sysconf ( _SC_PAGESIZE );\n",
+        "    skew = ( page > 0 ) ? ( ( size_t ) data % ( size_t ) page ) : 0;\n",
+        "\n",
+        "#if defined ( POSIX_MADV_WILLNEED )\n",
+        "    ( void ) posix_madvise ( ( void * ) ( ( unsigned char const * ) data - skew ), size + skew, POSIX_MADV_WILLNEED );\n",
+        "#else\n",
+        "    ( void ) madvise ( ( void * ) ( ( unsigned char const * ) data - skew ), size + skew, MADV_WILLNEED );\n",
+        "#endif\n",
+        "#else\n",
+        "    ( void ) data;\n",
+        "    ( void ) size;\n",
+        "#endif\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_pack.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runpack_compare function
+*
+*  This function orders the entries of the pack by the hashes of the input
+*  binary files' names, for the "qsort" function.
+*
+*  Parameter(s)
+*
+*  left:   pointer to the first entry
+*  right:  pointer to the second entry
+*
+*  Return value(s)
+*
+*  <0:  the first entry precedes the second one
+*  ==0: the entries have the same hash
+*  >0:  the first entry follows the second one
+*/
+
+static int main_runpack_compare
+(
+    void const * left,
+    void const * right
+)
+{
+    unsigned long first;
+    unsigned long second;
+
+    first =  ( ( main_entry const * ) left )->hash;
+    second = ( ( main_entry const * ) right )->hash;
+
+    return ( ( first > second ) - ( first < second ) );
+}
+
+
+
+/*
+** main_runpack_slot function
+*
+*  This function computes the index entry that a name's hash selects with the
+*  given seed, exactly like the "bin2c_pack_slot" function of "bin2c_pack.h".
+*
+*  Parameter(s)
+*
+*  hash:   the hash of the input binary file's name
+*  seed:   the seed of the hash's bucket
+*  count:  the number of entries
+*
+*  Return value(s)
+*
+*  The index entry, which is less than "count".
+*/
+
+static unsigned long main_runpack_slot
+(
+    unsigned long hash,
+    unsigned long seed,
+    unsigned long count
+)
+{
+    unsigned long mixed;
+
+    mixed =  ( hash + ( seed * 0x9E3779B9ul ) ) & 0xFFFFFFFFul;
+    mixed ^= mixed >> 16;
+    mixed =  ( mixed * 0x85EBCA6Bul ) & 0xFFFFFFFFul;
+    mixed ^= mixed >> 13;
+    mixed =  ( mixed * 0xC2B2AE35ul ) & 0xFFFFFFFFul;
+    mixed ^= mixed >> 16;
+
+    return ( mixed % count );
+}
+
+
+
+/*
+** main_runpack_perfect function
+*
+*  This function finds a minimal perfect hash of the input binary files' names,
+*  for the "-i" option, and reorders the entries of the pack to match it.
+*
+*  Parameter(s)
+*
+*  entries:  pointer to the entries of the pack, whose hashes differ
+*  count:    the number of entries
+*  seeds:    pointer to the array that receives the seed of every bucket
+*  buckets:  the number of buckets
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred, such as a heap allocation failing or
+*            a bucket without a seed below "MAIN_PACKSEEDS", and the entries
+*            are in their original order
+*  !=false:  success; the entries are in the order of the perfect hash
+*
+*  Remarks
+*
+*  This is the "hash and displace" method: the hash of a name selects a bucket
+*  and, with the bucket's seed, an entry.  The buckets with the most names go
+*  first, while most entries are free, and each one takes the first seed that
+*  puts its names on free entries.  Lookups then take one hash of the name, and
+*  one comparison with the name of the entry that it selects.
+*/
+
+static bool main_runpack_perfect
+(
+    main_entry * restrict    entries,
+    int                      count,
+    unsigned long * restrict seeds,
+    unsigned long            buckets
+)
+{
+    bool                     success;
+    unsigned long            total;
+    unsigned long            largest;
+    int * restrict           members;
+    int * restrict           slots;
+    unsigned long * restrict starts;
+    main_entry * restrict    sorted;
+
+    total =   ( unsigned long ) count;
+    largest = 0;
+
+    members = NULL;
+    slots =   NULL;
+    starts =  NULL;
+    sorted =  NULL;
+
+    success =  ( size_t ) count <= ( SIZE_MAX / sizeof ( *sorted ) );
+    success &= buckets < ( SIZE_MAX / sizeof ( *starts ) );
+
+    if ( success )
+    {
+        members = ( int * ) malloc ( sizeof ( *members ) * ( size_t ) count );
+        slots =   ( int * ) malloc ( sizeof ( *slots ) * ( size_t ) count );
+        starts =  ( unsigned long * ) calloc ( ( size_t ) buckets + 1u,
+                                               sizeof ( *starts ) );
+        sorted =  ( main_entry * ) malloc ( sizeof ( *sorted ) * ( size_t ) count );
+        success = ( members != NULL ) && ( slots != NULL ) && ( starts != NULL ) && ( sorted != NULL );
+    }
+
+    /*
+    ** The members of every bucket are adjacent in "members", from the bucket's
+    *  element of "starts" up to the next bucket's (which a counting sort puts
+    *  there).
+    */
+
+    if ( success )
+    {
+        unsigned long bucket;
+        int           entry;
+
+        for ( entry = 0; entry < count; entry += 1 )
+        {
+            starts[entries[entry].hash % buckets] += 1u;
+            slots[entry] =                           -1;
+        }
+
+        for ( bucket = 1; bucket < buckets; bucket += 1u )
+        {
+            starts[bucket] += starts[bucket - 1u];
+        }
+
+        starts[buckets] = total;
+
+        for ( entry = count - 1; entry >= 0; entry -= 1 )
+        {
+            bucket = entries[entry].hash % buckets;
+
+            starts[bucket] -=         1u;
+            members[starts[bucket]] = entry;
+        }
+
+        for ( bucket = 0; bucket < buckets; bucket += 1u )
+        {
+            seeds[bucket] = 0;
+
+            if ( ( starts[bucket + 1u] - starts[bucket] ) > largest )
+            {
+                largest = starts[bucket + 1u] - starts[bucket];
+            }
+        }
+    }
+
+    /*
+    ** Counting down from the largest bucket's number of names visits the
+    *  buckets from the most names to the fewest.
+    */
+
+    if ( success )
+    {
+        unsigned long size;
+
+        for ( size = largest; success && ( size > 0 ); size -= 1u )
+        {
+            unsigned long bucket;
+
+            for ( bucket = 0; success && ( bucket < buckets ); bucket += 1u )
+            {
+                unsigned long seed;
+                unsigned long first;
+                unsigned long last;
+
+                first = starts[bucket];
+                last =  starts[bucket + 1u];
+
+                if ( ( last - first ) != size )
+                {
+                    continue;
+                }
+
+                for ( seed = 0; seed < MAIN_PACKSEEDS; seed += 1u )
+                {
+                    unsigned long member;
+
+                    for ( member = first; member < last; member += 1u )
+                    {
+                        unsigned long slot;
+
+                        slot = main_runpack_slot ( entries[members[member]].hash,
+                                                   seed,
+                                                   total );
+
+                        if ( slots[slot] >= 0 )
+                        {
+                            break;
+                        }
+
+                        slots[slot] = members[member];
+                    }
+
+                    if ( member == last )
+                    {
+                        break;
+                    }
+
+                    while ( member > first )
+                    {
+                        member -= 1u;
+
+                        slots[main_runpack_slot ( entries[members[member]].hash,
+                                                  seed,
+                                                  total )] = -1;
+                    }
+                }
+
+                seeds[bucket] = seed;
+                success =       seed < MAIN_PACKSEEDS;
+            }
+        }
+    }
+
+    if ( success )
+    {
+        int slot;
+
+        for ( slot = 0; slot < count; slot += 1 )
+        {
+            sorted[slot] = entries[slots[slot]];
+        }
+
+        memcpy ( entries,
+                 sorted,
+                 sizeof ( *entries ) * ( size_t ) count );
+    }
+
+    if ( sorted != NULL )
+    {
+        free ( sorted );
+    }
+
+    if ( starts != NULL )
+    {
+        free ( starts );
+    }
+
+    if ( slots != NULL )
+    {
+        free ( slots );
+    }
+
+    if ( members != NULL )
+    {
+        free ( members );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputtable function
+*
+*  This function outputs one of the arrays of the pack's index.
+*
+*  Parameter(s)
+*
+*  pack:       pointer to the name of the pack (i.e.: the "<pack>" parameter)
+*  suffix:     pointer to the suffix of the array's name
+*  values:     pointer to the elements of the array
+*  count:      the number of elements
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the array
+*/
+
+static bool main_runpack_outputtable
+(
+    char const * restrict           pack,
+    char const * restrict           suffix,
+    unsigned long const * restrict  values,
+    unsigned long                   count,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    bool          success;
+    unsigned long index;
+    int           error;
+
+    error =   fputs ( "static unsigned long const ",
+                      outfile );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            suffix,
+                                            outfile );
+
+    error =    fputs ( "[] =\n{",
+                       outfile );
+    success &= error >= 0;
+
+    for ( index = 0; success && ( index < count ); index += 1u )
+    {
+        error =    fprintf ( outfile,
+                             ( ( index % 8u ) == 0 ) ? "%s\n    %luul" : "%s %luul",
+                             ( index > 0 ) ? "," : "",
+                             values[index] );
+        success &= error >= 0;
+    }
+
+    error =    fputs ( "\n};\n\n",
+                       outfile );
+    success &= error >= 0;
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputnames function
+*
+*  This function outputs the names of the input binary files, for the lookup
+*  function of the "-i" option, as a character array with the "_names" suffix,
+*  in which every name is null-terminated.
+*
+*  Parameter(s)
+*
+*  pack:       pointer to the name of the pack (i.e.: the "<pack>" parameter)
+*  entries:    pointer to the entries of the pack, in the order of the index
+*  count:      the number of entries
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the array
+*
+*  Remarks
+*
+*  Every name is a string literal of its own on a line of its own.
+*/
+
+static bool main_runpack_outputnames
+(
+    char const * restrict           pack,
+    main_entry const * restrict     entries,
+    int                             count,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+    int  index;
+    int  error;
+
+    error =   fputs ( "static char const ",
+                      outfile );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_names",
+                                            outfile );
+
+    error =    fputs ( "[] =",
+                       outfile );
+    success &= error >= 0;
+
+    for ( index = 0; success && ( index < count ); index += 1 )
+    {
+        error =    fputs ( "\n    \"",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_outputliteral ( entries[index].name,
+                                        outfile );
+
+        error =    fputs ( "\\0\"",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    error =    fputs ( ";\n\n",
+                       outfile );
+    success &= error >= 0;
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputlookup function
+*
+*  This function outputs the lookup function of the "-i" option, which finds
+*  the entry of an input binary file by its name with the minimal perfect hash
+*  of "main_runpack_perfect".
+*
+*  Parameter(s)
+*
+*  pack:       pointer to the name of the pack (i.e.: the "<pack>" parameter)
+*  buckets:    the number of buckets of the perfect hash
+*  count:      the number of entries
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the lookup function
+*
+*  Remarks
+*
+*  The function takes the name and its length (without a null-terminating
+*  character), and returns the entry or "BIN2C_PACK_NONE".  The "_spans" array
+*  holds the offset of every name in the "_names" array, and the offset past
+*  the last one, so that a name's length is the difference of two of them.
+*/
+
+static bool main_runpack_outputlookup
+(
+    char const * restrict           pack,
+    unsigned long                   buckets,
+    int                             count,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+    int  error;
+
+    error =   fprintf ( outfile,
+                        "BIN2C_PACK_API size_t %s ( char const * name, size_t length )\n{\n    size_t index;\n\n    index = bin2c_pack_slot ( bin2c_pack_hashn ( name, length ), ",
+                        arguments->lookup );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_seeds",
+                                            outfile );
+
+    error =    fprintf ( outfile,
+                         ", %luu, %du );\n\n    if ( ( ( size_t ) ( ",
+                         buckets,
+                         count );
+    success &= error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_spans",
+                                            outfile );
+
+    error =    fputs ( "[index + 1u] - ",
+                       outfile );
+    success &= error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_spans",
+                                            outfile );
+
+    error =    fputs ( "[index] ) == ( length + 1u ) ) && ( memcmp ( ",
+                       outfile );
+    success &= error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_names",
+                                            outfile );
+
+    error =    fputs ( " + ",
+                       outfile );
+    success &= error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            "_spans",
+                                            outfile );
+
+    error =    fputs ( "[index], name, length ) == 0 ) )\n    {\n        return ( index );\n    }\n\n    return ( BIN2C_PACK_NONE );\n}\n\n",
+                       outfile );
+    success &= error >= 0;
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputaccessor function
+*
+*  This function outputs the C++20 accessor of the pack, "bin2c::get", which
+*  resolves an input binary file's name to its data at compile time.
+*
+*  Parameter(s)
+*
+*  pack:       pointer to the name of the pack (i.e.: the "<pack>" parameter)
+*  entries:    pointer to the entries of the pack, in the order of the index
+*  count:      the number of entries
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the accessor
+*
+*  Remarks
+*
+*  The accessor is a "consteval" function that compares the name with every
+*  input binary file's name and returns a "std::span" of "unsigned char const"
+*  elements of the pack (rather than of "std::byte" elements, given that the
+*  "reinterpret_cast" that would take is not a constant expression).  Since it
+*  only exists at compile time, it needs no table in the program, and an
+*  unknown name reaches the call of a function that is not "constexpr", which
+*  is a compile error.  It resides in an inline namespace named after the pack
+*  (with the prefix), so that "bin2c::get" is unambiguous unless several packs
+*  are present, in which case the pack's namespace qualifies it.  The
+*  preprocessor only keeps the accessor for C++20 and later.
+*/
+
+static bool main_runpack_outputaccessor
+(
+    char const * restrict           pack,
+    main_entry const * restrict     entries,
+    int                             count,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+    int  index;
+    int  error;
+
+    error =   fputs ( "#if defined ( __cplusplus ) && ( __cplusplus >= 202002l ) && defined ( __cpp_consteval )\n\n#include <span>\n#include <string_view>\n\nnamespace bin2c\n{\n    inline namespace ",
+                      outfile );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            pack,
+                                            NULL,
+                                            outfile );
+
+    error =    fputs ( "\n    {\n        void unknown_name ( std::string_view name );\n\n        consteval std::span<unsigned char const> get ( std::string_view name )\n        {\n",
+                       outfile );
+    success &= error >= 0;
+
+    for ( index = 0; success && ( index < count ); index += 1 )
+    {
+        error =    fputs ( "            if ( name == \"",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_outputliteral ( entries[index].name,
+                                        outfile );
+
+        error =    fputs ( "\" )\n            {\n                return ( std::span<unsigned char const> ( ::",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                pack,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             " + %luul, %luul ) );\n            }\n\n",
+                             entries[index].offset,
+                             entries[index].size );
+        success &= error >= 0;
+    }
+
+    error =    fputs ( "            unknown_name ( name );\n\n            return ( std::span<unsigned char const> ( ) );\n        }\n    }\n}\n\n#endif\n\n",
+                       outfile );
+    success &= error >= 0;
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputwillneed function
+*
+*  This function outputs the macro and the function of the hot input binary
+*  files of the "-o" option, which span the start of the pack.
+*
+*  Parameter(s)
+*
+*  macro:      pointer to the pack's macro (i.e.: the capitalized prefix and
+*              "<pack>", with an underscore)
+*  hot:        the number of bytes that the hot input binary files span
+*  arguments:  pointer to the parameters of the command-line options
+*  outfile:    pointer to the "FILE" object for the output header file
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output file has the macro and the function
+*/
+
+static bool main_runpack_outputwillneed
+(
+    char const * restrict           macro,
+    unsigned long                   hot,
+    main_arguments const * restrict arguments,
+    FILE * restrict                 outfile
+)
+{
+    bool success;
+    int  error;
+
+    error =   fprintf ( outfile,
+                        "#define %sHOT  %luu\n\nBIN2C_PACK_API void ",
+                        macro,
+                        hot );
+    success = error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            arguments->pack,
+                                            "_willneed",
+                                            outfile );
+
+    error =    fputs ( " ( void )\n{\n    bin2c_pack_willneed ( ",
+                       outfile );
+    success &= error >= 0;
+
+    success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                            arguments->pack,
+                                            arguments->suffix,
+                                            outfile );
+
+    error =    fprintf ( outfile,
+                         ", %sHOT );\n}\n\n",
+                         macro );
+    success &= error >= 0;
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack_outputindex function
+*
+*  This function outputs the header file of the pack's index, "<pack>_index.h",
+*  next to the pack's own C file(s).
+*
+*  Parameter(s)
+*
+*  inpath:     pointer to the pathname of the first input binary file, whose
+*              directory receives the header file
+*  entries:    pointer to the entries of the pack, in the order of the index
+*  count:      the number of entries
+*  seeds:      pointer to the seeds of the perfect hash, with the "-i" option;
+*              "NULL" without the "-i" option
+*  buckets:    the number of buckets of the perfect hash
+*  hot:        the number of bytes at the start of the pack that the hot input
+*              binary files span, with the "-o" option
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output header file has the index
+*
+*  Remarks
+*
+*  The header file includes the pack's header file and "bin2c_pack.h", and
+*  defines a macro for the number of entries, with the "_COUNT" suffix, and a
+*  macro per input binary file for its entry, named after the pack and the
+*  input binary file, so that code that knows which input binary file it wants
+*  needs no lookup.  The index itself is arrays of "unsigned long" elements
+*  (with the "_offsets" and "_sizes" suffixes, and either the "_hashes" suffix
+*  or, with the "-i" option, the "_seeds" and "_spans" suffixes next to the
+*  "_names" array), which hold numbers rather than pointers, so they need no
+*  relocations when the program loads.  They have static scope, given that they
+*  are small.  For C++20, the header file also has the "bin2c::get" accessor of
+*  "main_runpack_outputaccessor".  With the "-o" option, a macro with the "_HOT"
+*  suffix holds the number of bytes of the hot input binary files, and a
+*  function with the "_willneed" suffix passes them to "bin2c_pack_willneed".
+*/
+
+static bool main_runpack_outputindex
+(
+    char const * restrict           inpath,
+    main_entry const * restrict     entries,
+    int                             count,
+    unsigned long const * restrict  seeds,
+    unsigned long                   buckets,
+    unsigned long                   hot,
+    main_arguments const * restrict arguments
+)
+{
+    bool                     success;
+    char * restrict          symbol;
+    char * restrict          outpath;
+    unsigned long * restrict values;
+    FILE * restrict          outfile;
+
+    outpath = NULL;
+    outfile = NULL;
+
+    symbol =  ( char * ) malloc ( sizeof ( *symbol ) * ( strlen ( arguments->pack ) + sizeof ( "_index" ) ) );
+    values =  NULL;
+    success = symbol != NULL;
+
+    if ( success )
+    {
+        success = ( size_t ) count < ( SIZE_MAX / sizeof ( *values ) );
+    }
+
+    if ( success )
+    {
+        values =  ( unsigned long * ) malloc ( sizeof ( *values ) * ( ( size_t ) count + 1u ) );
+        success = values != NULL;
+    }
+
+    if ( success )
+    {
+        strcpy ( symbol,
+                 arguments->pack );
+        strcat ( symbol,
+                 "_index" );
+
+        outpath = main_constructsharedpath ( inpath,
+                                             symbol );
+        success = outpath != NULL;
+    }
+
+    if ( success )
+    {
+        outpath[strlen ( outpath ) - 1u] = 'h';
+
+        outfile = tmpfile ( );
+        success = outfile != NULL;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( symbol,
+                                              outfile );
+
+        error =    fprintf ( outfile,
+                             "#include \"bin2c_pack.h\"\n#include \"%s.h\"\n\n",
+                             arguments->pack );
+        success &= error >= 0;
+
+    }
+
+    /*
+    ** The macros of the entries are the pack's macro (i.e.: the capitalized
+    *  prefix and "<pack>") followed by "_COUNT" or by an underscore and the
+    *  capitalized name of the input binary file, without the extension.
+    */
+
+    if ( success )
+    {
+        char * restrict macro;
+
+        macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                                 arguments->pack,
+                                                 "_" );
+        success = macro != NULL;
+
+        if ( success )
+        {
+            int error;
+            int index;
+
+            error =   fprintf ( outfile,
+                                "#define %sCOUNT  %du\n\n",
+                                macro,
+                                count );
+            success = error >= 0;
+
+            for ( index = 0; success && ( index < count ); index += 1 )
+            {
+                char * restrict name;
+
+                name =    ( char * ) malloc ( sizeof ( *name ) * ( strlen ( entries[index].name ) + 1u ) );
+                success = name != NULL;
+
+                if ( success )
+                {
+                    char * restrict entry;
+
+                    strcpy ( name,
+                             entries[index].name );
+
+                    entry =   main_runbin2c_constructmacro ( macro,
+                                                             main_shortenname ( name ),
+                                                             NULL );
+                    success = entry != NULL;
+
+                    if ( success )
+                    {
+                        error =   fprintf ( outfile,
+                                            "#define %s  %du\n",
+                                            entry,
+                                            index );
+                        success = error >= 0;
+
+                        free ( entry );
+                    }
+
+                    free ( name );
+                }
+            }
+
+            error =    fputs ( "\n",
+                               outfile );
+            success &= error >= 0;
+
+            if ( arguments->trace != NULL )
+            {
+                success &= main_runpack_outputwillneed ( macro,
+                                                         hot,
+                                                         arguments,
+                                                         outfile );
+            }
+
+            free ( macro );
+
+        }
+
+    }
+
+    if ( success && ( seeds == NULL ) )
+    {
+        int index;
+
+        for ( index = 0; index < count; index += 1 )
+        {
+            values[index] = entries[index].hash;
+        }
+
+        success = main_runpack_outputtable ( arguments->pack,
+                                             "_hashes",
+                                             values,
+                                             ( unsigned long ) count,
+                                             arguments,
+                                             outfile );
+    }
+
+    if ( success && ( seeds != NULL ) )
+    {
+        int index;
+
+        values[0] = 0;
+
+        for ( index = 0; index < count; index += 1 )
+        {
+            values[index + 1] = values[index] + ( unsigned long ) strlen ( entries[index].name ) + 1u;
+        }
+
+        success &= main_runpack_outputtable ( arguments->pack,
+                                              "_seeds",
+                                              seeds,
+                                              buckets,
+                                              arguments,
+                                              outfile );
+
+        success &= main_runpack_outputnames ( arguments->pack,
+                                              entries,
+                                              count,
+                                              arguments,
+                                              outfile );
+
+        success &= main_runpack_outputtable ( arguments->pack,
+                                              "_spans",
+                                              values,
+                                              ( unsigned long ) count + 1u,
+                                              arguments,
+                                              outfile );
+    }
+
+    if ( success )
+    {
+        int index;
+
+        for ( index = 0; index < count; index += 1 )
+        {
+            values[index] = entries[index].offset;
+        }
+
+        success = main_runpack_outputtable ( arguments->pack,
+                                             "_offsets",
+                                             values,
+                                             ( unsigned long ) count,
+                                             arguments,
+                                             outfile );
+    }
+
+    if ( success )
+    {
+        int index;
+
+        for ( index = 0; index < count; index += 1 )
+        {
+            values[index] = entries[index].size;
+        }
+
+        success = main_runpack_outputtable ( arguments->pack,
+                                             "_sizes",
+                                             values,
+                                             ( unsigned long ) count,
+                                             arguments,
+                                             outfile );
+    }
+
+    if ( success && ( seeds != NULL ) )
+    {
+        success = main_runpack_outputlookup ( arguments->pack,
+                                              buckets,
+                                              count,
+                                              arguments,
+                                              outfile );
+    }
+
+    if ( success )
+    {
+        success = main_runpack_outputaccessor ( arguments->pack,
+                                                entries,
+                                                count,
+                                                arguments,
+                                                outfile );
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =    fputs ( "#endif\n",
+                           outfile );
+        success &= error >= 0;
+
+        error =    fflush ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runpack_outputindexer ( outpath );
+    }
+
+    if ( outpath != NULL )
+    {
+        free ( outpath );
+    }
+
+    if ( values != NULL )
+    {
+        free ( values );
+    }
+
+    if ( symbol != NULL )
+    {
+        free ( symbol );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runpack function
+*
+*  This function outputs all input binary files as a single array, the pack of
+*  the "-u" option, with an index that finds each input binary file's data in
+*  it, instead of an array per input binary file.
+*
+*  Parameter(s)
+*
+*  inpaths:    pointer to the pathnames of the input binary files
+*  incount:    the number of input binary files
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the output file(s) have the pack and its index
+*
+*  Remarks
+*
+*  The pack is named "<pack>" and resides next to the first input binary file,
+*  like the shared arrays of "main_runshared".  Every input binary file's data
+*  starts at a multiple of "MAIN_PACKALIGNMENT" bytes, and the array itself is
+*  aligned to at least as many bytes.  Every input binary file's name (with the
+*  extension) must have a hash of its own, which also excludes input binary
+*  files of the same name in different directories.  With the "-i" option, the
+*  index is in the order of a minimal perfect hash instead of the hashes' order,
+*  with about "MAIN_PACKLOAD" names per bucket.  With the "-o" option, the hot
+*  input binary files come first, in the order of the access trace, and the
+*  others start on the next page, so that the hot ones share no page with them
+*  (the array then being aligned to at least a page).
+*/
+
+static bool main_runpack
+(
+    char * const * restrict         inpaths,
+    int                             incount,
+    main_arguments const * restrict arguments
+)
+{
+    bool                     success;
+    main_arguments           settings;
+    main_entry * restrict    entries;
+    unsigned long * restrict seeds;
+    unsigned long            buckets;
+    unsigned char * restrict buffer;
+    FILE * restrict          packfile;
+    unsigned long            total;
+    unsigned long            hot;
+
+    settings = *arguments;
+
+    if ( ( settings.alignment == NULL ) || ( settings.alignsize < MAIN_PACKALIGNMENT ) )
+    {
+        settings.alignment = "16";
+        settings.alignsize = MAIN_PACKALIGNMENT;
+    }
+
+    if ( ( settings.trace != NULL ) && ( settings.alignsize < MAIN_MMAPALIGNMENT ) )
+    {
+        settings.alignment = "page";
+        settings.alignsize = MAIN_MMAPALIGNMENT;
+    }
+
+    total = 0;
+    hot =   0;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( MAIN_CHUNKSIZE >= MAIN_MMAPALIGNMENT );
+
+    entries =  NULL;
+    seeds =    NULL;
+    buckets =  0;
+    buffer =   ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    packfile = tmpfile ( );
+    success =  ( buffer != NULL ) && ( packfile != NULL );
+
+    if ( success )
+    {
+        success = ( size_t ) incount <= ( SIZE_MAX / sizeof ( *entries ) );
+    }
+
+    if ( success )
+    {
+        entries = ( main_entry * ) malloc ( sizeof ( *entries ) * ( size_t ) incount );
+        success = entries != NULL;
+    }
+
+    /*
+    ** Every input binary file's data follows the previous one's, after enough
+    *  zero bytes to align it, which the previous entry's size excludes.  The
+    *  first cold input binary file's data is aligned to a page instead.
+    */
+
+    if ( success )
+    {
+        int input;
+
+        for ( input = 0; success && ( input < incount ); input += 1 )
+        {
+            main_entry * restrict entry;
+            char const * restrict path;
+            char const * restrict name;
+            FILE * restrict       infile;
+            size_t                count;
+            unsigned long         alignment;
+
+            entry = entries + input;
+            path =  inpaths[( arguments->order != NULL ) ? arguments->order[input] : input];
+            name =  main_findname ( path );
+
+            entry->hash = main_hashdata ( ( unsigned char const * ) name,
+                                          strlen ( name ) );
+            entry->size = 0;
+            entry->name = name;
+
+            alignment = ( ( arguments->order != NULL ) && ( input == arguments->hotcount ) ) ? MAIN_MMAPALIGNMENT : MAIN_PACKALIGNMENT;
+
+            memset ( buffer,
+                     0,
+                     ( size_t ) alignment );
+
+            count =   ( size_t ) ( ( alignment - ( total % alignment ) ) % alignment );
+            success =  fwrite ( buffer,
+                                sizeof ( *buffer ),
+                                count,
+                                packfile ) == count;
+            success &= total <= ( ULONG_MAX - count );
+
+            total +=        ( unsigned long ) count;
+            entry->offset = total;
+
+            infile =  fopen ( path,
+                              "rb" );
+            success &= infile != NULL;
+
+            while ( success )
+            {
+                count = fread ( buffer,
+                                sizeof ( *buffer ),
+                                MAIN_CHUNKSIZE,
+                                infile );
+
+                success =  fwrite ( buffer,
+                                    sizeof ( *buffer ),
+                                    count,
+                                    packfile ) == count;
+                success &= ( unsigned long ) count <= ( ULONG_MAX - total );
+
+                total +=       ( unsigned long ) count;
+                entry->size += ( unsigned long ) count;
+
+                if ( count < MAIN_CHUNKSIZE )
+                {
+                    success &= ferror ( infile ) == 0;
+                    break;
+                }
+            }
+
+            if ( infile != NULL )
+            {
+                fclose ( infile );
+            }
+
+            if ( input < arguments->hotcount )
+            {
+                hot = total;
+            }
+
+            if ( !success )
+            {
+                fputs ( "ERROR: failed to read the input binary file into the pack.",
+                        stderr );
+            }
+        }
+    }
+
+    /*
+    ** The index is sorted by the hashes, so that "bin2c_pack_find" can search
+    *  it, and two input binary files with the same hash could not both be found.
+    */
+
+    if ( success )
+    {
+        int input;
+
+        qsort ( entries,
+                ( size_t ) incount,
+                sizeof ( *entries ),
+                main_runpack_compare );
+
+        for ( input = 1; success && ( input < incount ); input += 1 )
+        {
+            success = entries[input].hash != entries[input - 1].hash;
+        }
+
+        if ( !success )
+        {
+            fputs ( "ERROR: the names of two input binary files have the same hash.",
+                    stderr );
+        }
+    }
+
+    if ( success && ( arguments->lookup != NULL ) )
+    {
+        buckets = ( ( unsigned long ) incount + ( MAIN_PACKLOAD - 1u ) ) / MAIN_PACKLOAD;
+        seeds =   ( unsigned long * ) malloc ( sizeof ( *seeds ) * ( size_t ) buckets );
+        success = seeds != NULL;
+
+        if ( success )
+        {
+            success = main_runpack_perfect ( entries,
+                                             incount,
+                                             seeds,
+                                             buckets );
+        }
+
+        if ( !success )
+        {
+            fputs ( "ERROR: failed to find a perfect hash of the input binary files' names.",
+                    stderr );
+        }
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( packfile );
+        success = error == 0;
+
+        rewind ( packfile );
+    }
+
+    if ( success )
+    {
+        success = main_runarray ( inpaths[0],
+                                  arguments->pack,
+                                  packfile,
+                                  &settings );
+    }
+
+    if ( success )
+    {
+        success = main_runpack_outputindex ( inpaths[0],
+                                             entries,
+                                             incount,
+                                             seeds,
+                                             buckets,
+                                             hot,
+                                             arguments );
+
+        if ( !success )
+        {
+            fputs ( "ERROR: failed to create the index of the pack.",
+                    stderr );
+        }
+    }
+
+    if ( packfile != NULL )
+    {
+        fclose ( packfile );
+    }
+
+    if ( seeds != NULL )
+    {
+        free ( seeds );
+    }
+
+    if ( entries != NULL )
+    {
+        free ( entries );
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runsidecar_outputmapper function
+*
+*  This function creates (or leaves untouched, when it is current) the support
+*  header file, "bin2c_mmap.h", that holds the functions that map the pack file
+*  of the "-f" option, next to the output C file(s).
+*
+*  Parameter(s)
+*
+*  outpath:  pointer to the pathname for the output files, as "main_runbin2c"
+*            receives it
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the support header file likely is in
+*            an incomplete form
+*  !=false:  success; the support header file is current
+*/
+
+static bool main_runsidecar_outputmapper
+(
+    char const * restrict outpath
+)
+{
+    static char const * const lines[] =
+    {
+        "/*\n",
+        "** bin2c mapped pack\n",
+        "*\n",
+        "*  This header file accompanies the output C file(s) of bin2c's \"-f\" option,\n",
+        "*  which writes all input files' data into a pack file instead of arrays, for\n",
+        "*  data that is too large to link.  The pack file starts with a page that\n",
+        "*  stamps it with its size and a hash of its data, which the output C file(s)\n",
+        "*  also hold, and every input file's data starts on a page of its own.  Only\n",
+        "*  the stamp is checked, not the data, which would page in the whole pack file,\n",
+        "*  so a stale or foreign pack file fails, but a corrupted one does not.  The\n",
+        "*  functions map the whole pack file into memory on first use, read-only and\n",
+        "*  shared, so that the system pages the data in on demand and processes share\n",
+        "*  its pages.  Threads may race to use a pack first: each one maps the pack\n",
+        "*  file, but only one mapping survives and the others are unmapped.  With the\n",
+        "*  \"-o\" option, the input files that an access trace names come first in the\n",
+        "*  pack file, and a function advises the system to page them in ahead of use.\n",
+        "*/\n",
+        "\n",
+        "#if !defined ( __BIN2C_MMAP_H__ )\n",
+        "\n",
+        "#define __BIN2C_MMAP_H__\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "#include <string.h>\n",
+        "\n",
+        "#if defined ( _WIN32 )\n",
+        "#if !defined ( WIN32_LEAN_AND_MEAN )\n",
+        "#define WIN32_LEAN_AND_MEAN\n",
+        "#endif\n",
+        "#include <windows.h>\n",
+        "#define BIN2C_MMAP_WINDOWS\n",
+        "#elif defined ( __unix__ ) || ( defined ( __APPLE__ ) && defined ( __MACH__ ) )\n",
+        "#include <sys/types.h>\n",
+        "#include <sys/mman.h>\n",
+        "#include <sys/stat.h>\n",
+        "#include <fcntl.h>\n",
+        "#include <unistd.h>\n",
+        "#define BIN2C_MMAP_POSIX\n",
+        "#endif\n",
+        "\n",
+        "#if defined ( __cplusplus ) || ( defined ( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901l ) )\n",
+        "#define BIN2C_MMAP_API  static inline\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_MMAP_API  static __inline__ __attribute__ ( ( unused ) )\n",
+        "#else\n",
+        "#define BIN2C_MMAP_API  static\n",
+        "#endif\n",
+        "\n",
+        "/*\n",
+        "** The pointer to the mapping is published with an atomic compare-and-swap,\n",
+        "*  where the compiler has one.  (Elsewhere, only one thread may use a pack.)\n",
+        "*/\n",
+        "\n",
+        "#if defined ( _MSC_VER )\n",
+        "#define BIN2C_MMAP_LOAD( base )              InterlockedCompareExchangePointer ( ( base ), NULL, NULL )\n",
+        "#define BIN2C_MMAP_PUBLISH( base, mapping )  InterlockedCompareExchangePointer ( ( base ), ( mapping ), NULL )\n",
+        "#elif defined ( __GNUC__ )\n",
+        "#define BIN2C_MMAP_LOAD( base )              __atomic_load_n ( ( base ), __ATOMIC_ACQUIRE )\n",
+        "#define BIN2C_MMAP_PUBLISH( base, mapping )  __sync_val_compare_and_swap ( ( base ), NULL, ( mapping ) )\n",
+        "#else\n",
+        "#define BIN2C_MMAP_LOAD( base )              ( *( base ) )\n",
+        "#define BIN2C_MMAP_PUBLISH( base, mapping )  ( ( *( base ) == NULL ) ? ( ( *( base ) = ( mapping ) ), ( void * ) NULL ) : *( base ) )\n",
+        "#endif\n",
+        "\n",
+        "#define BIN2C_MMAP_MAGIC  \"BIN2CMAP\"\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_span type\n",
+        "*\n",
+        "*  An input file's data: where it is mapped and its number of bytes, or \"NULL\"\n",
+        "*  and zero when the pack file is not available.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    unsigned char const * data;\n",
+        "    size_t                size;\n",
+        "} bin2c_mmap_span;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_pack type\n",
+        "*\n",
+        "*  A pack file: its mapping (\"NULL\" until first use), its pathname, which the\n",
+        "*  program may change before first use, and the size and hash it must have.\n",
+        "*/\n",
+        "\n",
+        "typedef struct\n",
+        "{\n",
+        "    void *        base;\n",
+        "    char const *  path;\n",
+        "    size_t        size;\n",
+        "    unsigned long hash;\n",
+        "} bin2c_mmap_pack;\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_unmap function\n",
+        "*\n",
+        "*  Unmaps the \"size\" bytes of the mapping at \"base\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API void bin2c_mmap_unmap ( void * base, size_t size )\n",
+        "{\n",
+        "#if defined ( BIN2C_MMAP_WINDOWS )\n",
+        "    ( void ) size;\n",
+        "    UnmapViewOfFile ( base );\n",
+        "#elif defined ( BIN2C_MMAP_POSIX )\n",
+        "    munmap ( base, size );\n",
+        "#else\n",
+        "    ( void ) base;\n",
+        "    ( void ) size;\n",
+        "#endif\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_check function\n",
+        "*\n",
+        "*  Returns non-zero when the mapping at \"base\" of a pack file of \"size\" bytes\n",
+        "*  starts with the stamp of that size and the hash \"hash\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API int bin2c_mmap_check ( unsigned char const * base, size_t size, unsigned long hash )\n",
+        "{\n",
+        "    size_t index;\n",
+        "\n",
+        "    if ( memcmp ( base, BIN2C_MMAP_MAGIC, 8u ) != 0 )\n",
+        "    {\n",
+        "        return ( 0 );\n",
+        "    }\n",
+        "\n",
+        "    for ( index = 8u; index < 16u; index += 1u )\n",
+        "    {\n",
+        "        if ( base[index] != ( unsigned char ) ( size & 255u ) )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "\n",
+        "        size >>= 8;\n",
+        "    }\n",
+        "\n",
+        "    for ( index = 16u; index < 20u; index += 1u )\n",
+        "    {\n",
+        "        if ( base[index] != ( unsigned char ) ( hash & 255u ) )\n",
+        "        {\n",
+        "            return ( 0 );\n",
+        "        }\n",
+        "\n",
+        "        hash >>= 8;\n",
+        "    }\n",
+        "\n",
+        "    return ( 1 );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_map function\n",
+        "*\n",
+        "*  Maps the pack file at \"path\" into memory, read-only and shared.  Returns the\n",
+        "*  mapping, or \"NULL\" when the pack file cannot be mapped or its size or stamp\n",
+        "*  differ from \"size\" and \"hash\".\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API void * bin2c_mmap_map ( char const * path, size_t size, unsigned long hash )\n",
+        "{\n",
+        "    void * base;\n",
+        "\n",
+        "    base = NULL;\n",
+        "\n",
+        "#if defined ( BIN2C_MMAP_WINDOWS )\n",
+        "    {\n",
+        "        HANDLE        file;\n",
+        "        LARGE_INTEGER length;\n",
+        "\n",
+        "        file = CreateFileA ( path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );\n",
+        "\n",
+        "        if ( file != INVALID_HANDLE_VALUE )\n",
+        "        {\n",
+        "            if ( GetFileSizeEx ( file, &length ) && ( ( unsigned __int64 ) length.QuadPart == ( unsigned __int64 ) size ) )\n",
+        "            {\n",
+        "                HANDLE mapping;\n",
+        "\n",
+        "                mapping = CreateFileMappingA ( file, NULL, PAGE_READONLY, 0, 0, NULL );\n",
+        "\n",
+        "                if ( mapping != NULL )\n",
+        "                {\n",
+        "                    base = MapViewOfFile ( mapping, FILE_MAP_READ, 0, 0, 0 );\n",
+        "\n",
+        "                    CloseHandle ( mapping );\n",
+        "                }\n",
+        "            }\n",
+        "\n",
+        "            CloseHandle ( file );\n",
+        "        }\n",
+        "    }\n",
+        "#elif defined ( BIN2C_MMAP_POSIX )\n",
+        "    {\n",
+        "        int         file;\n",
+        "        struct stat status;\n",
+        "\n",
+        "        file = open ( path, O_RDONLY );\n",
+        "\n",
+        "        if ( file >= 0 )\n",
+        "        {\n",
+        "            if ( ( fstat ( file, &status ) == 0 ) && ( ( size_t ) status.st_size == size ) && ( size > 0 ) )\n",
+        "            {\n",
+        "                base = mmap ( NULL, size, PROT_READ, MAP_SHARED, file, 0 );\n",
+        "                base = ( base != MAP_FAILED ) ? base : NULL;\n",
+        "            }\n",
+        "\n",
+        "            close ( file );\n",
+        "        }\n",
+        "    }\n",
+        "#else\n",
+        "    ( void ) path;\n",
+        "#endif\n",
+        "\n",
+        "    if ( ( base != NULL ) && !bin2c_mmap_check ( ( unsigned char const * ) base, size, hash ) )\n",
+        "    {\n",
+        "        bin2c_mmap_unmap ( base, size );\n",
+        "\n",
+        "        base = NULL;\n",
+        "    }\n",
+        "\n",
+        "    return ( base );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_open function\n",
+        "*\n",
+        "*  Returns the mapping of \"pack\", which the first call maps, or \"NULL\" when the\n",
+        "*  pack file cannot be mapped (which a later call retries).\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API unsigned char const * bin2c_mmap_open ( bin2c_mmap_pack * pack )\n",
+        "{\n",
+        "    void * base;\n",
+        "\n",
+        "    base = BIN2C_MMAP_LOAD ( &pack->base );\n",
+        "\n",
+        "    if ( base == NULL )\n",
+        "    {\n",
+        "        void * mapping;\n",
+        "\n",
+        "        mapping = bin2c_mmap_map ( pack->path, pack->size, pack->hash );\n",
+        "\n",
+        "        if ( mapping != NULL )\n",
+        "        {\n",
+        "            base = BIN2C_MMAP_PUBLISH ( &pack->base, mapping );\n",
+        "\n",
+        "            if ( base != NULL )\n",
+        "            {\n",
+        "                bin2c_mmap_unmap ( mapping, pack->size );\n",
+        "            }\n",
+        "            else\n",
+        "            {\n",
+        "                base = mapping;\n",
+        "            }\n",
+        "        }\n",
+        "    }\n",
+        "\n",
+        "    return ( ( unsigned char const * ) base );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_get function\n",
+        "*\n",
+        "*  Returns the \"size\" bytes at \"offset\" in the pack file of \"pack\", which is\n",
+        "*  mapped on first use.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API bin2c_mmap_span bin2c_mmap_get ( bin2c_mmap_pack * pack, size_t offset, size_t size )\n",
+        "{\n",
+        "    bin2c_mmap_span       span;\n",
+        "    unsigned char const * base;\n",
+        "\n",
+        "    base = bin2c_mmap_open ( pack );\n",
+        "\n",
+        "    span.data = ( base != NULL ) ? ( base + offset ) : NULL;\n",
+        "    span.size = ( base != NULL ) ? size : 0;\n",
+        "\n",
+        "    return ( span );\n",
+        "}\n",
+        "\n",
+        "\n",
+        "\n",
+        "/*\n",
+        "** bin2c_mmap_willneed function\n",
+        "*\n",
+        "*  Advises the system that the \"size\" bytes at \"offset\" in the pack file of\n",
+        "*  \"pack\" (e.g.: the hot input files) are needed soon, so that it pages them in\n",
+        "*  with a few large reads instead of a fault per page.  Maps the pack file like\n",
+        "*  first use does, and does nothing more on systems without such advice.\n",
+        "*/\n",
+        "\n",
+        "BIN2C_MMAP_API void bin2c_mmap_willneed ( bin2c_mmap_pack * pack, size_t offset, size_t size )\n",
+        "{\n",
+        "    unsigned char const * base;\n",
+        "\n",
+        "    base = bin2c_mmap_open ( pack );\n",
+        "\n",
+        "#if defined ( BIN2C_MMAP_WINDOWS ) && defined ( _WIN32_WINNT ) && ( _WIN32_WINNT >= 0x0602 )\n",
+        "    if ( base != NULL )\n",
+        "    {\n",
+        "        WIN32_MEMORY_RANGE_ENTRY range;\n",
+        "\n",
+        "        range.VirtualAddress = ( void * ) ( base + offset );\n",
+        "        range.NumberOfBytes =  size;\n",
+        "\n",
+        "        PrefetchVirtualMemory ( GetCurrentProcess ( ), 1, &range, 0 );\n",
+        "    }\n",
+        "#elif defined ( BIN2C_MMAP_POSIX ) && ( defined ( POSIX_MADV_WILLNEED ) || defined ( MADV_WILLNEED ) )\n",
+        "    if ( base != NULL )\n",
+        "    {\n",
+        "        long   page;\n",
+        "        size_t skew;\n",
+        "\n",
+        "        page = sysconf ( _SC_PAGESIZE );\n",
+        "        skew = ( page > 0 ) ? ( offset % ( size_t ) page ) : 0;\n",
+        "\n",
+        "#if defined ( POSIX_MADV_WILLNEED )\n",
+        "        ( void ) posix_madvise ( ( void * ) ( base + offset - skew ), size + skew, POSIX_MADV_WILLNEED );\n",
+        "#else\n",
+        "        ( void ) madvise ( ( void * ) ( base + offset - skew ), size + skew, MADV_WILLNEED );\n",
+        "#endif\n",
+        "    }\n",
+        "#else\n",
+        "    ( void ) base;\n",
+        "    ( void ) offset;\n",
+        "    ( void ) size;\n",
+        "#endif\n",
+        "}\n",
+        "\n",
+        "#endif\n",
+        NULL
+    };
+
+    return ( main_outputsupport ( outpath,
+                                  "bin2c_mmap.h",
+                                  lines ) );
+}
+
+
+
+/*
+** main_runsidecar_outputheader function
+*
+*  This function outputs the header file of the pack file of the "-f" option,
+*  "<pack>.h", which declares the pack and an accessor per input binary file.
+*
+*  Parameter(s)
+*
+*  outpath:    pointer to the pathname of the header file, with a single-
+*              character extension that this function replaces with "h"
+*  entries:    pointer to the entries of the pack file, in its order
+*  count:      the number of entries
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output header file has the declarations
+*
+*  Remarks
+*
+*  The accessors are functions, so the declarations have C linkage in C++, like
+*  the source file's definitions.  With the "-o" option, the header file also
+*  declares the pack's function with the "_willneed" suffix.
+*/
+
+static bool main_runsidecar_outputheader
+(
+    char * restrict                 outpath,
+    main_entry const * restrict     entries,
+    int                             count,
+    main_arguments const * restrict arguments
+)
+{
+    bool            success;
+    FILE * restrict outfile;
+
+    outpath[strlen ( outpath ) - 1u] = 'h';
+
+    outfile = tmpfile ( );
+    success = outfile != NULL;
+
+    if ( success )
+    {
+        int error;
+
+        success = main_runbin2c_outputguard ( arguments->sidecar,
+                                              outfile );
+
+        error =    fputs ( "#include \"bin2c_mmap.h\"\n\n#if defined ( __cplusplus )\nextern \"C\"\n{\n#endif\n\nextern bin2c_mmap_pack ",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->sidecar,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fputs ( ";\n\n",
+                           outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int index;
+
+        for ( index = 0; success && ( index < count ); index += 1 )
+        {
+            int error;
+
+            error =   fputs ( "bin2c_mmap_span ",
+                              outfile );
+            success = error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    entries[index].name,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fputs ( " ( void );\n",
+                               outfile );
+            success &= error >= 0;
+        }
+    }
+
+    if ( success && ( arguments->trace != NULL ) )
+    {
+        int error;
+
+        error =   fputs ( "\nvoid ",
+                          outfile );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->sidecar,
+                                                "_willneed",
+                                                outfile );
+
+        error =    fputs ( " ( void );\n",
+                           outfile );
+        success &= error >= 0;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fputs ( "\n#if defined ( __cplusplus )\n}\n#endif\n\n#endif\n",
+                          outfile );
+        success = error >= 0;
+
+        error =    fflush ( outfile );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        fclose ( outfile );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runsidecar_outputsource function
+*
+*  This function outputs the source file of the pack file of the "-f" option,
+*  "<pack>.c", which defines the pack and the accessors.
+*
+*  Parameter(s)
+*
+*  outpath:    pointer to the pathname of the source file, with a single-
+*              character extension that this function replaces with "c"
+*  entries:    pointer to the entries of the pack file, in its order
+*  count:      the number of entries
+*  total:      the number of bytes of the pack file
+*  hash:       the hash of the pack file's data, which its stamp holds
+*  hot:        the number of bytes after the stamp that the hot input binary
+*              files span, with the "-o" option
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file likely is in an
+*            incomplete form
+*  !=false:  success; the output source file has the definitions
+*
+*  Remarks
+*
+*  The pack's pathname is "<pack>.bin", relative to the working directory,
+*  unless a macro of the pack's capitalized name and "_PATH" says otherwise
+*  when the source file compiles, or the program changes the pack's "path"
+*  member before first use.  With the "-o" option, the pack's function with the
+*  "_willneed" suffix passes the hot input binary files to "bin2c_mmap_willneed".
+*/
+
+static bool main_runsidecar_outputsource
+(
+    char * restrict                 outpath,
+    main_entry const * restrict     entries,
+    int                             count,
+    unsigned long                   total,
+    unsigned long                   hash,
+    unsigned long                   hot,
+    main_arguments const * restrict arguments
+)
+{
+    bool            success;
+    FILE * restrict outfile;
+    char * restrict macro;
+
+    outpath[strlen ( outpath ) - 1u] = 'c';
+
+    macro =   main_runbin2c_constructmacro ( arguments->prefix,
+                                             arguments->sidecar,
+                                             "_PATH" );
+    outfile = tmpfile ( );
+    success = ( macro != NULL ) && ( outfile != NULL );
+
+    if ( success )
+    {
+        int error;
+
+        error =   fprintf ( outfile,
+                            "#include \"%s.h\"\n\n#if !defined ( %s )\n#define %s  \"%s.bin\"\n#endif\n\nbin2c_mmap_pack ",
+                            arguments->sidecar,
+                            macro,
+                            macro,
+                            arguments->sidecar );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->sidecar,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             " = { NULL, %s, %luu, %luul };\n",
+                             macro,
+                             total,
+                             hash );
+        success &= error >= 0;
+
+    }
+
+    if ( success )
+    {
+        int index;
+
+        for ( index = 0; success && ( index < count ); index += 1 )
+        {
+            int error;
+
+            error =   fputs ( "\nbin2c_mmap_span ",
+                              outfile );
+            success = error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    entries[index].name,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fputs ( " ( void )\n{\n    return ( bin2c_mmap_get ( &",
+                               outfile );
+            success &= error >= 0;
+
+            success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                    arguments->sidecar,
+                                                    arguments->suffix,
+                                                    outfile );
+
+            error =    fprintf ( outfile,
+                                 ", %luu, %luu ) );\n}\n",
+                                 entries[index].offset,
+                                 entries[index].size );
+            success &= error >= 0;
+        }
+    }
+
+    if ( success && ( arguments->trace != NULL ) )
+    {
+        int error;
+
+        error =   fputs ( "\nvoid ",
+                          outfile );
+        success = error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->sidecar,
+                                                "_willneed",
+                                                outfile );
+
+        error =    fputs ( " ( void )\n{\n    bin2c_mmap_willneed ( &",
+                           outfile );
+        success &= error >= 0;
+
+        success &= main_runbin2c_outputsymbol ( arguments->prefix,
+                                                arguments->sidecar,
+                                                arguments->suffix,
+                                                outfile );
+
+        error =    fprintf ( outfile,
+                             ", %luu, %luu );\n}\n",
+                             ( unsigned long ) MAIN_MMAPALIGNMENT,
+                             hot );
+        success &= error >= 0;
+    }
+
+    if ( success )
+    {
+        int error;
+
+        error =   fflush ( outfile );
+        success = error >= 0;
+
+    }
+
+    if ( success )
+    {
+        success = main_runbin2c_commitfile ( outfile,
+                                             outpath );
+    }
+
+    if ( outfile != NULL )
+    {
+        fclose ( outfile );
+    }
+
+    if ( macro != NULL )
+    {
+        free ( macro );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_runsidecar function
+*
+*  This function writes all input binary files' data into the pack file of the
+*  "-f" option, instead of an array per input binary file, and outputs the C
+*  file(s) that map it.
+*
+*  Parameter(s)
+*
+*  inpaths:    pointer to the pathnames of the input binary files
+*  incount:    the number of input binary files
+*  arguments:  pointer to the parameters of the command-line options
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error occurred and the output file(s) likely are in an
+*            incomplete form
+*  !=false:  success; the pack file and its C files are complete
+*
+*  Remarks
+*
+*  The pack file, "<pack>.bin", and its C files reside next to the first input
+*  binary file, like the pack of "main_runpack".  Its first "MAIN_MMAPALIGNMENT"
+*  bytes are the stamp: "BIN2CMAP", then the size of the pack file in eight
+*  bytes and the 32-bit FNV-1a hash of the input binary files' data in four
+*  bytes, least significant first, and zero bytes.  Every input binary file's
+*  data then starts at a multiple of "MAIN_MMAPALIGNMENT" bytes.  Checking the
+*  stamp, rather than hashing the data again, keeps first use from paging in
+*  the whole pack file.  The pack file is large by design, so it is written in
+*  place rather than staged.  With the "-o" option, the hot input binary files
+*  come first, in the order of the access trace, right after the stamp.
+*/
+
+static bool main_runsidecar
+(
+    char * const * restrict         inpaths,
+    int                             incount,
+    main_arguments const * restrict arguments
+)
+{
+    bool                     success;
+    main_entry * restrict    entries;
+    unsigned char * restrict buffer;
+    char * restrict          outpath;
+    char * restrict          packpath;
+    FILE * restrict          packfile;
+    unsigned long            total;
+    unsigned long            hash;
+    unsigned long            hot;
+
+    total =    0;
+    hash =     2166136261ul;
+    hot =      0;
+    entries =  NULL;
+    packpath = NULL;
+    packfile = NULL;
+
+    CHECK ( ( SIZE_MAX / sizeof ( *buffer ) ) >= MAIN_CHUNKSIZE );
+    CHECK ( MAIN_CHUNKSIZE >= MAIN_MMAPALIGNMENT );
+
+    buffer =  ( unsigned char * ) malloc ( sizeof ( *buffer ) * MAIN_CHUNKSIZE );
+    outpath = main_constructsharedpath ( inpaths[0],
+                                         arguments->sidecar );
+    success = ( buffer != NULL ) && ( outpath != NULL );
+
+    if ( success )
+    {
+        success = ( size_t ) incount <= ( SIZE_MAX / sizeof ( *entries ) );
+    }
+
+    if ( success )
+    {
+        entries = ( main_entry * ) malloc ( sizeof ( *entries ) * ( size_t ) incount );
+        success = entries != NULL;
+    }
+
+    if ( success )
+    {
+        size_t offset;
+
+        offset =   strlen ( outpath ) - 1u;
+        packpath = ( char * ) malloc ( sizeof ( *packpath ) * ( offset + 4u ) );
+        success =  packpath != NULL;
+
+        if ( success )
+        {
+            memcpy ( packpath,
+                     outpath,
+                     offset );
+            strcpy ( packpath + offset,
+                     "bin" );
+
+            packfile = fopen ( packpath,
+                               "wb" );
+            success =  packfile != NULL;
+        }
+    }
+
+    /*
+    ** The stamp's page is zero bytes until the data's hash is known, and so is
+    *  the padding before every input binary file's data.
+    */
+
+    if ( success )
+    {
+        int input;
+
+        memset ( buffer,
+                 0,
+                 MAIN_MMAPALIGNMENT );
+
+        for ( input = 0; success && ( input < incount ); input += 1 )
+        {
+            main_entry * restrict entry;
+            char * restrict       path;
+            FILE * restrict       infile;
+            size_t                count;
+
+            entry = entries + input;
+            path =  inpaths[( arguments->order != NULL ) ? arguments->order[input] : input];
+
+            entry->hash = 0;
+            entry->size = 0;
+
+            count =   ( size_t ) ( MAIN_MMAPALIGNMENT - ( total % MAIN_MMAPALIGNMENT ) );
+            success =  fwrite ( buffer,
+                                sizeof ( *buffer ),
+                                count,
+                                packfile ) == count;
+            success &= total <= ( ULONG_MAX - count );
+
+            total +=        ( unsigned long ) count;
+            entry->offset = total;
+
+            infile =  fopen ( path,
+                              "rb" );
+            success &= infile != NULL;
+
+            while ( success )
+            {
+                size_t index;
+
+                count = fread ( buffer,
+                                sizeof ( *buffer ),
+                                MAIN_CHUNKSIZE,
+                                infile );
+
+                success =  fwrite ( buffer,
+                                    sizeof ( *buffer ),
+                                    count,
+                                    packfile ) == count;
+                success &= ( unsigned long ) count <= ( ULONG_MAX - total );
+
+                total +=       ( unsigned long ) count;
+                entry->size += ( unsigned long ) count;
+
+                for ( index = 0; index < count; index += 1u )
+                {
+                    hash ^= ( unsigned long ) buffer[index];
+                    hash =  ( hash * 16777619ul ) & 0xFFFFFFFFul;
+                }
+
+                if ( count < MAIN_CHUNKSIZE )
+                {
+                    success &= ferror ( infile ) == 0;
+                    break;
+                }
+            }
+
+            if ( infile != NULL )
+            {
+                fclose ( infile );
+            }
+
+            if ( input < arguments->hotcount )
+            {
+                hot = total - MAIN_MMAPALIGNMENT;
+            }
+
+            entry->name = main_shortenname ( path );
+
+            memset ( buffer,
+                     0,
+                     MAIN_MMAPALIGNMENT );
+
+            if ( !success )
+            {
+                fputs ( "ERROR: failed to write the input binary file into the pack file.",
+                        stderr );
+            }
+        }
+    }
+
+    if ( success )
+    {
+        unsigned long value;
+        unsigned int  index;
+
+        memcpy ( buffer,
+                 "BIN2CMAP",
+                 8u );
+
+        for ( value = total, index = 8u; index < 16u; index += 1u )
+        {
+            buffer[index] = ( unsigned char ) ( value & 0xFFu );
+            value >>=       8;
+        }
+
+        for ( value = hash, index = 16u; index < 20u; index += 1u )
+        {
+            buffer[index] = ( unsigned char ) ( value & 0xFFu );
+            value >>=       8;
+        }
+
+        success =  fseek ( packfile,
+                           0l,
+                           SEEK_SET ) == 0;
+        success &= fwrite ( buffer,
+                            sizeof ( *buffer ),
+                            20u,
+                            packfile ) == 20u;
+    }
+
+    if ( packfile != NULL )
+    {
+        int error;
+
+        error =    fclose ( packfile );
+        success &= error == 0;
+
+    }
+
+    if ( success )
+    {
+        success =  main_runsidecar_outputheader ( outpath,
+                                                  entries,
+                                                  incount,
+                                                  arguments );
+        success &= main_runsidecar_outputsource ( outpath,
+                                                  entries,
+                                                  incount,
+                                                  total,
+                                                  hash,
+                                                  hot,
+                                                  arguments );
+        success &= main_runsidecar_outputmapper ( outpath );
+
+        if ( !success )
+        {
+            fputs ( "ERROR: failed to create the C files of the pack file.",
+                    stderr );
+        }
+    }
+
+    if ( packpath != NULL )
+    {
+        free ( packpath );
+    }
+
+    if ( outpath != NULL )
+    {
+        free ( outpath );
+    }
+
+    if ( entries != NULL )
+    {
+        free ( entries );
+    }
+
+    if ( buffer != NULL )
+    {
+        free ( buffer );
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_matchkeyword function
+*
+*  This function compares an option's parameter with a keyword, ignoring the
+*  case of the characters, consistent with the options themselves being case
+*  insensitive.
+*
+*  Parameter(s)
+*
+*  parameter:  pointer to the option's parameter from the command line
+*  keyword:    pointer to the lower-case keyword to compare with
+*
+*  Return value(s)
+*
+*  ==false:  the parameter differs from the keyword
+*  !=false:  the parameter matches the keyword
+*/
+
+static bool main_matchkeyword
+(
+    char const * restrict parameter,
+    char const * restrict keyword
+)
+{
+
+    while ( ( *keyword != '\0' ) && ( tolower ( ( unsigned char ) *parameter ) == *keyword ) )
+    {
+        parameter += 1u;
+        keyword +=   1u;
+    }
+
+    return ( ( *parameter == '\0' ) && ( *keyword == '\0' ) );
+}
+
+
+
+/*
+** main_parsesize function
+*
+*  This function converts an option's parameter into a size, which consists of
+*  decimal digits optionally followed by a "k" or "m" multiplier (i.e.: 1024 or
+*  1048576, respectively), ignoring the case of the multiplier.
+*
+*  Parameter(s)
+*
+*  parameter:  pointer to the option's parameter from the command line
+*  size:       pointer to the variable that receives the size
+*
+*  Return value(s)
+*
+*  ==false:  failure; the parameter is malformed or the size exceeds
+*            "ULONG_MAX", and "*size" is in an undefined state
+*  !=false:  success; "*size" is the size that the parameter expresses
+*/
+
+static bool main_parsesize
+(
+    char const * restrict    parameter,
+    unsigned long * restrict size
+)
+{
+    bool          success;
+    unsigned long multiplier;
+
+    success = isdigit ( ( unsigned char ) *parameter ) != 0;
+    *size =   0;
+
+    while ( success && isdigit ( ( unsigned char ) *parameter ) )
+    {
+        unsigned long digit;
+
+        digit =   ( unsigned long ) ( *parameter - '0' );
+        success = *size <= ( ( ULONG_MAX - digit ) / 10u );
+        *size =   ( *size * 10u ) + digit;
+
+        parameter += 1u;
+    }
+
+    switch ( *parameter )
+    {
+
+        case 'k':
+        case 'K':
+        multiplier = 1024ul;
+        parameter += 1u;
+        break;
+
+        case 'm':
+        case 'M':
+        multiplier = 1024ul * 1024ul;
+        parameter += 1u;
+        break;
+
+        default:
+        multiplier = 1u;
+        break;
+
+    }
+
+    success &= *parameter == '\0';
+    success &= *size <= ( ULONG_MAX / multiplier );
+    *size *=   multiplier;
+
+    return ( success );
+}
+
+
+
+/*
+** main_parseblocks function
+*
+*  This function converts the "-k" option's parameter into the size of the
+*  independently compressed blocks and the size of the blocks with CRC32C
+*  checksums, which consists of one or both of a size (see "main_parsesize")
+*  and "crc32c:" followed by a size, separated by a comma (e.g.: "64k",
+*  "crc32c:4k" or "64k,crc32c:4k").
+*
+*  Parameter(s)
+*
+*  parameter:  pointer to the option's parameter from the command line
+*  blocksize:  pointer to the variable that receives the size of the
+*              compressed blocks, or zero without a plain size
+*  hashsize:   pointer to the variable that receives the size of the blocks
+*              with checksums, or zero without a "crc32c:" item
+*
+*  Return value(s)
+*
+*  ==false:  failure; the parameter is not valid
+*  !=false:  success; the variables receive the sizes
+*
+*  Remarks
+*
+*  Every size must be positive and fit in half a "size_t", given that the
+*  compressor holds a whole block at once (as the decoder of a partially
+*  covered block does).  Each item may be present only once.
+*/
+
+static bool main_parseblocks
+(
+    char const * restrict    parameter,
+    unsigned long * restrict blocksize,
+    unsigned long * restrict hashsize
+)
+{
+    bool success;
+
+    success =    true;
+    *blocksize = 0;
+    *hashsize =  0;
+
+    while ( success && ( parameter != NULL ) )
+    {
+        char                     item[32];
+        char const * restrict    comma;
+        char * restrict          colon;
+        unsigned long * restrict size;
+        size_t                   length;
+
+        comma =   strchr ( parameter,
+                           ',' );
+        length =  ( comma != NULL ) ? ( size_t ) ( comma - parameter ) : strlen ( parameter );
+        colon =   NULL;
+        size =    blocksize;
+        success = length < sizeof ( item );
+
+        if ( success )
+        {
+            memcpy ( item,
+                     parameter,
+                     length );
+
+            item[length] = '\0';
+            colon =        strchr ( item,
+                                    ':' );
+        }
+
+        if ( success && ( colon != NULL ) )
+        {
+            *colon =  '\0';
+            success = main_matchkeyword ( item,
+                                          "crc32c" );
+            size =    hashsize;
+        }
+
+        if ( success )
+        {
+            success &= *size == 0;
+            success &= main_parsesize ( ( colon != NULL ) ? ( colon + 1u ) : item,
+                                        size );
+            success &= *size > 0;
+            success &= *size <= ( SIZE_MAX / 2u );
+        }
+
+        parameter = ( comma != NULL ) ? ( comma + 1u ) : NULL;
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_parsetype function
+*
+*  This function converts the "-t" option's parameter into an element type,
+*  which consists of the type's keyword optionally followed by the byte order
+*  of the input binary file's elements, "le" (the default) or "be", ignoring
+*  case (e.g.: "float", "int16be" or "uint32le").
+*
+*  Parameter(s)
+*
+*  parameter:  pointer to the option's parameter from the command line
+*  element:    pointer to the variable that receives the element type
+*  bigendian:  pointer to the variable that receives whether the elements are
+*              big-endian
+*
+*  Return value(s)
+*
+*  ==false:  failure; the parameter names no type or byte order, and "*element"
+*            and "*bigendian" are in an undefined state
+*  !=false:  success; "*element" points to the element type
+*
+*  Remarks
+*
+*  The types' keywords are the names of "<stdint.h>" types without the "_t"
+*  suffix, except for the floating-point types, which are "float" and "double"
+*  as in C.  No keyword is a prefix of another one followed by "le" or "be".
+*/
+
+static bool main_parsetype
+(
+    char const * restrict        parameter,
+    main_type const * * restrict element,
+    bool * restrict              bigendian
+)
+{
+    static main_type const types[] =
+    {
+        { "int8",   "int8_t",   "",   1u, MAIN_KIND_SIGNED },
+        { "uint8",  "uint8_t",  "u",  1u, MAIN_KIND_UNSIGNED },
+        { "int16",  "int16_t",  "",   2u, MAIN_KIND_SIGNED },
+        { "uint16", "uint16_t", "u",  2u, MAIN_KIND_UNSIGNED },
+        { "int32",  "int32_t",  "l",  4u, MAIN_KIND_SIGNED },
+        { "uint32", "uint32_t", "ul", 4u, MAIN_KIND_UNSIGNED },
+        { "int64",  "int64_t",  "",   8u, MAIN_KIND_SIGNED },
+        { "uint64", "uint64_t", "",   8u, MAIN_KIND_UNSIGNED },
+        { "float",  "float",    "",   4u, MAIN_KIND_FLOAT },
+        { "double", "double",   "",   8u, MAIN_KIND_FLOAT }
+    };
+
+    size_t index;
+
+    for ( index = 0; index < ( sizeof ( types ) / sizeof ( *types ) ); index += 1u )
+    {
+        char const * restrict keyword;
+        char const * restrict order;
+
+        keyword = types[index].name;
+        order =   parameter;
+
+        while ( ( *keyword != '\0' ) && ( tolower ( ( unsigned char ) *order ) == *keyword ) )
+        {
+            order +=   1u;
+            keyword += 1u;
+        }
+
+        if ( *keyword != '\0' )
+        {
+            continue;
+        }
+
+        if ( ( *order == '\0' ) || main_matchkeyword ( order,
+                                                      "le" ) )
+        {
+            *element =   &types[index];
+            *bigendian = false;
+
+            return ( true );
+        }
+
+        if ( main_matchkeyword ( order,
+                                 "be" ) )
+        {
+            *element =   &types[index];
+            *bigendian = true;
+
+            return ( true );
+        }
+    }
+
+    return ( false );
+}
+
+
+
+/*
+** main_readlayout_reserved function
+*
+*  This function tells whether a field's name is a keyword of C (up to C23) or
+*  C++ (up to C++20), which the compiler would reject as a member's or an
+*  array's name.
+*
+*  Parameter(s)
+*
+*  name:  pointer to the field's name
+*
+*  Return value(s)
+*
+*  ==false:  the name is no keyword
+*  !=false:  the name is a keyword
+*/
+
+static bool main_readlayout_reserved
+(
+    char const * restrict name
+)
+{
+    static char const * const keywords[] =
+    {
+        "alignas",           "alignof",           "and",               "and_eq",            "asm",
+        "auto",              "bitand",            "bitor",             "bool",              "break",
+        "case",              "catch",             "char",              "char8_t",           "char16_t",
+        "char32_t",          "class",             "compl",             "concept",           "const",
+        "consteval",         "constexpr",         "constinit",         "const_cast",        "continue",
+        "co_await",          "co_return",         "co_yield",          "decltype",          "default",
+        "delete",            "do",                "double",            "dynamic_cast",      "else",
+        "enum",              "explicit",          "export",            "extern",            "false",
+        "float",             "for",               "friend",            "goto",              "if",
+        "inline",            "int",               "long",              "mutable",           "namespace",
+        "new",               "noexcept",          "not",               "not_eq",            "nullptr",
+        "operator",          "or",                "or_eq",             "private",           "protected",
+        "public",            "register",          "reinterpret_cast",  "requires",          "restrict",
+        "return",            "short",             "signed",            "sizeof",            "static",
+        "static_assert",     "static_cast",       "struct",            "switch",            "template",
+        "this",              "thread_local",      "throw",             "true",              "try",
+        "typedef",           "typeid",            "typename",          "typeof",            "typeof_unqual",
+        "union",             "unsigned",          "using",             "virtual",           "void",
+        "volatile",          "wchar_t",           "while",             "xor",               "xor_eq",
+        "_Alignas",          "_Alignof",          "_Atomic",           "_BitInt",           "_Bool",
+        "_Complex",          "_Decimal32",        "_Decimal64",        "_Decimal128",       "_Generic",
+        "_Imaginary",        "_Noreturn",         "_Static_assert",    "_Thread_local"
+    };
+
+    size_t index;
+
+    for ( index = 0; index < ( sizeof ( keywords ) / sizeof ( *keywords ) ); index += 1u )
+    {
+        if ( strcmp ( keywords[index],
+                      name ) == 0 )
+        {
+            return ( true );
+        }
+    }
+
+    return ( false );
+}
+
+
+
+/*
+** main_readlayout function
+*
+*  This function converts the "-t" option's parameter into the layout of the
+*  input binary file's records, when it names no type.  The layout lists the
+*  fields, each a name and a type separated by a colon (e.g.: "x:float"), and
+*  the padding between them in bytes, separated by commas or white space.  A
+*  parameter that starts with "@" instead names a schema file that holds the
+*  layout, in which a "#" starts a comment up to the end of its line.
+*
+*  Parameter(s)
+*
+*  parameter:   pointer to the option's parameter from the command line
+*  layout:      pointer to the variable that receives the layout's text, which
+*               the fields' names point into
+*  fields:      pointer to the variable that receives the fields
+*  fieldcount:  pointer to the variable that receives the number of fields
+*  recordsize:  pointer to the variable that receives the number of bytes of a
+*               record
+*
+*  Return value(s)
+*
+*  ==false:  failure; the layout is malformed, has no fields, or has duplicate
+*            names or keywords as names, or the schema file is not readable,
+*            and "*layout" and "*fields" are "NULL"
+*  !=false:  success; "*fields" holds the fields in their order in a record
+*            (the caller must release the heap allocations of "*layout" and
+*            "*fields")
+*
+*  Remarks
+*
+*  A field's name must be a C identifier other than a keyword of C or C++ and
+*  its type is one that "main_parsetype" accepts, so every field has a byte order of its own (e.g.:
+*  "id:uint32be, 4, position:float").  The fields' offsets follow from their
+*  order and the padding alone, as in a packed structure.
+*/
+
+static bool main_readlayout
+(
+    char const * restrict            parameter,
+    char * restrict * restrict       layout,
+    main_field * restrict * restrict fields,
+    unsigned long * restrict         fieldcount,
+    unsigned long * restrict         recordsize
+)
+{
+    bool            success;
+    char * restrict text;
+    unsigned long   length;
+    unsigned long   capacity;
+    unsigned long   count;
+    unsigned long   offset;
+
+    text =    NULL;
+    *fields = NULL;
+    length =  0;
+
+    if ( *parameter == '@' )
+    {
+        unsigned char * restrict data;
+
+        data =    main_readbase ( parameter + 1u,
+                                  &length );
+        success = ( data != NULL ) && ( length < SIZE_MAX );
+
+        if ( success )
+        {
+            text =    ( char * ) realloc ( data,
+                                           ( size_t ) length + 1u );
+            success = text != NULL;
+        }
+
+        if ( !success && ( data != NULL ) )
+        {
+            free ( data );
+        }
+    }
+    else
+    {
+        length =  ( unsigned long ) strlen ( parameter );
+        text =    ( char * ) malloc ( sizeof ( *text ) * ( ( size_t ) length + 1u ) );
+        success = text != NULL;
+
+        if ( success )
+        {
+            memcpy ( text,
+                     parameter,
+                     ( size_t ) length );
+        }
+    }
+
+    /*
+    ** Every field has a colon of its own, so the colons bound the number of
+    *  fields.
+    */
+
+    capacity = 0;
+
+    if ( success )
+    {
+        unsigned long position;
+
+        text[length] = '\0';
+
+        for ( position = 0; position < length; position += 1u )
+        {
+            capacity += ( text[position] == ':' ) ? 1u : 0;
+            success &=  text[position] != '\0';
+        }
+
+        success &= capacity > 0;
+    }
+
+    if ( success )
+    {
+        *fields = ( main_field * ) malloc ( sizeof ( **fields ) * ( size_t ) capacity );
+        success = *fields != NULL;
+    }
+
+    count =  0;
+    offset = 0;
+
+    if ( success )
+    {
+        unsigned long position;
+        bool          comment;
+
+        position = 0;
+        comment =  false;
+
+        while ( success && ( position < length ) )
+        {
+            char const * restrict name;
+            char * restrict       colon;
+            char                  terminator;
+
+            if ( comment )
+            {
+                comment =  text[position] != '\n';
+                position += 1u;
+
+                continue;
+            }
+
+            if ( ( text[position] == '#' ) || ( text[position] == ',' ) || isspace ( ( unsigned char ) text[position] ) )
+            {
+                comment =  text[position] == '#';
+                position += 1u;
+
+                continue;
+            }
+
+            /*
+            ** The token ends at the next separator, which the null character
+            *  replaces (a comment still starts after it).
+            */
+
+            name = text + position;
+
+            while ( ( position < length ) && ( text[position] != '#' ) && ( text[position] != ',' ) && !isspace ( ( unsigned char ) text[position] ) )
+            {
+                position += 1u;
+            }
+
+            terminator =     text[position];
+            text[position] = '\0';
+            comment =        terminator == '#';
+            position +=      1u;
+            colon =          strchr ( name,
+                                      ':' );
+
+            if ( colon != NULL )
+            {
+                main_field * restrict field;
+                char const * restrict character;
+                unsigned long         other;
+
+                field =   &( *fields )[count];
+                *colon =  '\0';
+                success = main_parsetype ( colon + 1u,
+                                           &field->element,
+                                           &field->bigendian );
+
+                success &= ( isalpha ( ( unsigned char ) *name ) != 0 ) || ( *name == '_' );
+
+                for ( character = name; success && ( *character != '\0' ); character += 1u )
+                {
+                    success &= ( isalnum ( ( unsigned char ) *character ) != 0 ) || ( *character == '_' );
+                }
+
+                success &= !main_readlayout_reserved ( name );
+
+                for ( other = 0; success && ( other < count ); other += 1u )
+                {
+                    success &= strcmp ( ( *fields )[other].name,
+                                        name ) != 0;
+                }
+
+                if ( success )
+                {
+                    success = offset <= ( ULONG_MAX - field->element->size );
+                }
+
+                if ( success )
+                {
+                    field->name =   name;
+                    field->offset = offset;
+                    offset +=       field->element->size;
+                    count +=        1u;
+                }
+            }
+            else
+            {
+                unsigned long padding;
+
+                success = main_parsesize ( name,
+                                           &padding );
+
+                if ( success )
+                {
+                    success = offset <= ( ULONG_MAX - padding );
+                }
+
+                if ( success )
+                {
+                    offset += padding;
+                }
+            }
+        }
+
+        success &= count > 0;
+    }
+
+    if ( success )
+    {
+        *layout =     text;
+        *fieldcount = count;
+        *recordsize = offset;
+    }
+    else
+    {
+        if ( *fields != NULL )
+        {
+            free ( *fields );
+
+            *fields = NULL;
+        }
+
+        if ( text != NULL )
+        {
+            free ( text );
+        }
+
+        *layout = NULL;
+    }
+
+    return ( success );
+}
+
+
+
+/*
+** main_parseargs function
+*
+*  This function parses the command-line arguments.  It applies a typical
+*  "program <object> [-o <parameter>]" pattern to the arguments, but is case
+*  insensitive and does not support long option variants.
+*
+*  Parameter(s)
+*
+*  argc:        number of elements in "argv", excluding the terminating null
+*               element; must be non-negative
+*  argv:        pointer to an array of pointers to arguments
+*  program:     pointer to "argv[0]"; "*program" may be "NULL" when this
+*               function returns (which means "argv[0]" may be "NULL")
+*  inpaths:     pointer to "argv + 1", the input pathnames, which precede the
+*               options ("argv[1]" is a required argument)
+*  incount:     pointer to the number of input pathnames, which is at least one
+*               when this function returns success
+*  arguments:   pointer to the options' parameters (e.g.: the "<array_prefix>"
+*               parameter in the "[-p <array_prefix>]" option); any member may
+*               be "NULL" upon returning
+*
+*  Return value(s)
+*
+*  ==false:  failure; an error was encountered, such as "argv[0]" missing, and
+*            the parameters are in an undefined state
+*  !=false:  success; the parameters are consistent with "argc" and "argv"
+*
+*  Remarks
+*
+*  The purpose of the first pass of parsing command line arguments is largely to
+*  organize the arguments into an expected syntax.  This does not mean that the
+*  parameters are valid (e.g.: pathnames may be invalid, options' parameters may
+*  be invalid).  It only means mandatory parameters are present, no unknown
+*  options, no duplicate options, no spurious parameters, etc.
+*/
+
+static bool main_parseargs
+(
+    int                              argc,
+    char * const restrict * restrict argv,
+    char const * restrict * restrict program,
+    char * const * restrict *        inpaths,
+    int * restrict                   incount,
+    main_arguments * restrict        arguments
+)
+{
+    bool success;
+
+    success = true;
+
+    /*
+    ** Given that options can be in any order, every option must be compared
+    *  with all possible values.  Given that the parameter for an option follows
+    *  the option as the subsequent parameter, the loop needs another iteration
+    *  to retrieve the parameter.  Finally, given that duplicate instances of an
+    *  option are invalid and that no instance of an option is valid, the
+    *  options start as "NULL", must be "NULL" when being set, and might still
+    *  be "NULL" when this loop successfully completes.
+    */
+
+    arguments->prefix =     NULL;
+    arguments->suffix =     NULL;
+    arguments->global =     NULL;
+    arguments->extent =     NULL;
+    arguments->end =        NULL;
+    arguments->mode =       NULL;
+    arguments->form =       MAIN_FORM_DEFAULT;
+    arguments->shards =     NULL;
+    arguments->shardsize =  0;
+    arguments->lines =      NULL;
+    arguments->linesize =   0;
+    arguments->marks =      NULL;
+    arguments->marksize =   0;
+    arguments->alignment =  NULL;
+    arguments->alignsize =  0;
+    arguments->section =    NULL;
+    arguments->padding =    NULL;
+    arguments->padsize =    0;
+    arguments->codec =      NULL;
+    arguments->coding =     MAIN_CODEC_NONE;
+    arguments->automatic =  false;
+    arguments->window =     NULL;
+    arguments->windowsize = MAIN_LZWINDOW;
+    arguments->blocks =     NULL;
+    arguments->blocksize =  0;
+    arguments->hashsize =   0;
+    arguments->dictionary = NULL;
+    arguments->trained =    NULL;
+    arguments->dictsize =   0;
+    arguments->holes =      NULL;
+    arguments->holesize =   0;
+    arguments->pool =       NULL;
+    arguments->base =       NULL;
+    arguments->basename =   NULL;
+    arguments->baseline =   NULL;
+    arguments->basesize =   0;
+    arguments->pack =       NULL;
+    arguments->lookup =     NULL;
+    arguments->sidecar =    NULL;
+    arguments->reload =     NULL;
+    arguments->origin =     NULL;
+    arguments->trace =      NULL;
+    arguments->order =      NULL;
+    arguments->hotcount =   0;
+    arguments->cache =      NULL;
+    arguments->type =       NULL;
+    arguments->element =    NULL;
+    arguments->bigendian =  false;
+    arguments->layout =     NULL;
+    arguments->fields =     NULL;
+    arguments->fieldcount = 0;
+    arguments->recordsize = 0;
+
+    {
+        char const * restrict * restrict parameter;
+
+        parameter = NULL;
+
+        *incount = 0;
+
+        if ( argc > 0 )
         {
 
-            *outpath = *inpath;
+            *program = *argv;
+
+            argc -= 1;
+            argv += 1u;
+
+        }
+
+        /*
+        ** The input pathnames are all the arguments up to the first option.
+        */
+
+        *inpaths = ( char * const * ) argv;
+
+        while ( ( argc > 0 ) && ( **argv != '-' ) )
+        {
+
+            *incount += 1;
+
+            argc -= 1;
+            argv += 1u;
+
+        }
+
+        success &= *incount > 0;
+
+        while ( argc > 0 )
+        {
+
+            if ( **argv == '-' )
+            {
+                char const * restrict option;
+
+                success &= parameter == NULL;
+
+                option = *argv + 1u;
+
+                switch ( *option )
+                {
+
+                    case 'p':
+                    case 'P':
+                    parameter = &arguments->prefix;
+                    break;
+
+                    case 's':
+                    case 'S':
+                    parameter = &arguments->suffix;
+                    break;
+
+                    case 'g':
+                    case 'G':
+                    parameter = &arguments->global;
+                    break;
+
+                    case 'l':
+                    case 'L':
+                    parameter = &arguments->extent;
+                    break;
+
+                    case 'e':
+                    case 'E':
+                    parameter = &arguments->end;
+                    break;
+
+                    case 'm':
+                    case 'M':
+                    parameter = &arguments->mode;
+                    break;
+
+                    case 'j':
+                    case 'J':
+                    parameter = &arguments->shards;
+                    break;
+
+                    case 'b':
+                    case 'B':
+                    parameter = &arguments->lines;
+                    break;
+
+                    case 'n':
+                    case 'N':
+                    parameter = &arguments->marks;
+                    break;
+
+                    case 'a':
+                    case 'A':
+                    parameter = &arguments->alignment;
+                    break;
+
+                    case 'x':
+                    case 'X':
+                    parameter = &arguments->section;
+                    break;
+
+                    case 'z':
+                    case 'Z':
+                    parameter = &arguments->padding;
+                    break;
+
+                    case 'c':
+                    case 'C':
+                    parameter = &arguments->codec;
+                    break;
+
+                    case 'w':
+                    case 'W':
+                    parameter = &arguments->window;
+                    break;
 
-            length -=  1u;
-            inpath +=  1u;
-            outpath += 1u;
+                    case 'k':
+                    case 'K':
+                    parameter = &arguments->blocks;
+                    break;
+
+                    case 'd':
+                    case 'D':
+                    parameter = &arguments->dictionary;
+                    break;
+
+                    case 'h':
+                    case 'H':
+                    parameter = &arguments->holes;
+                    break;
+
+                    case 'y':
+                    case 'Y':
+                    parameter = &arguments->pool;
+                    break;
+
+                    case 'v':
+                    case 'V':
+                    parameter = &arguments->base;
+                    break;
+
+                    case 'u':
+                    case 'U':
+                    parameter = &arguments->pack;
+                    break;
+
+                    case 'i':
+                    case 'I':
+                    parameter = &arguments->lookup;
+                    break;
+
+                    case 'f':
+                    case 'F':
+                    parameter = &arguments->sidecar;
+                    break;
+
+                    case 'r':
+                    case 'R':
+                    parameter = &arguments->reload;
+                    break;
+
+                    case 'o':
+                    case 'O':
+                    parameter = &arguments->trace;
+                    break;
+
+                    case 'q':
+                    case 'Q':
+                    parameter = &arguments->cache;
+                    break;
+
+                    case 't':
+                    case 'T':
+                    parameter = &arguments->type;
+                    break;
+
+                    default:
+                    success = false;
+                    break;
+
+                }
+
+                option +=  1u;
+                success &= *option == '\0';
+
+            }
+
+            else
+            {
+                if ( parameter != NULL )
+                {
+                    *parameter = *argv;
+                    success &=   *parameter != NULL;
+                    parameter =  NULL;
+                }
+                else
+                {
+                    success = false;
+                }
+            }
+
+            argc -= 1;
+            argv += 1u;
 
         }
 
-        *outpath = '.';
-        outpath += 1u;
-        *outpath = ' ';
-        outpath += 1u;
+        success &= parameter == NULL;
 
-        *outpath = '\0';
-        outpath -= 2u;
+    }
 
-        outpath -= offset;
+    /*
+    ** The "argc" parameter must be non-negative.  At this point in the
+    *  function, if "argc" were non-negative, then it would be zero now.
+    *  Additionally, the "argv" parameter is null-terminated.  Therefore, this
+    *  final check catches both forms of invalid parameters.
+    */
 
+    if ( argc < 0 )
+    {
+        success = false;
+    }
+    else
+    {
+        success &= *argv == NULL;
     }
 
-    return ( outpath );
+    return ( success );
 }
 
 
 
 /*
-** main_parseargs function
+** main function
 *
-*  This function parses the command-line arguments.  It applies a typical
-*  "program <object> [-o <parameter>]" pattern to the arguments, but is case
-*  insensitive and does not support long option variants.
+*  This is the program's main function.  It's core purpose is to process
+*  arguments and call the "main_runbin2c" function with validated parameters.
 *
 *  Parameter(s)
 *
-*  argc:        number of elements in "argv", excluding the terminating null
-*               element; must be non-negative
-*  argv:        pointer to an array of pointers to arguments
-*  program:     pointer to "argv[0]"; "*program" may be "NULL" when this
-*               function returns (which means "argv[0]" may be "NULL")
-*  inpath:      pointer to "argv[1]"; "*inpath" will not be "NULL" when this
-*               function returns success ("argv[1]" is a required argument)
-*  prefix:      pointer to the prefix parameter (the "<array_prefix>" parameter
-*               in the "[-p <array_prefix>]" option); "*prefix" may be "NULL"
-*               upon returning
-*  suffix:      pointer to the suffix parameter (the "<array_suffix>" parameter
-*               in the "[-s <array_suffix>]" option); "*suffix" may be "NULL"
-*               upon returning
-*  global:      pointer to the global parameter (the "<length_suffix>" parameter
-*               in the "[-g <length_suffix>]" option); "*global" may be "NULL"
-*               upon returning
+*  argc:  number of elements in "argv", excluding the terminating null element;
+*         must be non-negative
+*  argv:  pointer to an array of pointers to arguments
 *
-*  Return value(s)
+*  Return value(s):
 *
-*  ==false:  failure; an error was encountered, such as "argv[0]" missing, and
-*            the parameters are in an undefined state
-*  !=false:  success; the parameters are consistent with "argc" and "argv"
+*  EXIT_SUCCESS:  success; the output file exists and is in a valid state
+*  EXIT_FAILURE:  failure; an error occurred and usage information was outputed
+*                 to the standard error pipe (and the output file may or may not
+*                 exist; if it exists, then it may or may not be valid)
 *
 *  Remarks
 *
-*  The purpose of the first pass of parsing command line arguments is largely to
-*  organize the arguments into an expected syntax.  This does not mean that the
-*  parameters are valid (e.g.: pathnames may be invalid, options' parameters may
-*  be invalid).  It only means mandatory parameters are present, no unknown
-*  options, no duplicate options, no spurious parameters, etc.
+*  While this function is the entry point to the program, it largely just
+*  processes arguments and calls the "main_runbin2c" function, which essentially
+*  is the program.  Where to draw the line between processing arguments and
+*  "being the program" is an art.  This function goes all the way to
+*  constructing pathnames and creating a "FILE" object for the input file
+*  because successfully creating a "FILE" object is strong validation of the
+*  pathname.  Conversely, it stops processing symbol names to simply forward
+*  the prefix, the core name, and the suffix as individual parameters to
+*  "main_runbin2c" given that avoids unnecessary heap allocations and keeps the
+*  "main_runbin2c" function's parameters similar to the command-line arguments.
 */
 
-static bool main_parseargs
+int main
 (
-    int                              argc,
-    char * const restrict * restrict argv,
-    char const * restrict * restrict program,
-    char * restrict * restrict       inpath,
-    char const * restrict * restrict prefix,
-    char const * restrict * restrict suffix,
-    char const * restrict * restrict global
+    int                     argc,
+    char * const * restrict argv
 )
 {
     bool success;
@@ -1298,226 +16599,514 @@ static bool main_parseargs
     success = true;
 
     /*
-    ** Given that options can be in any order, every option must be compared
-    *  with all possible values.  Given that the parameter for an option follows
-    *  the option as the subsequent parameter, the loop needs another iteration
-    *  to retrieve the parameter.  Finally, given that duplicate instances of an
-    *  option are invalid and that no instance of an option is valid, the
-    *  options start as "NULL", must be "NULL" when being set, and might still
-    *  be "NULL" when this loop successfully completes.
+    ** This function manages failures in three sections.  This first section
+    *  effectively considers all failures as argument validation failures.  The
+    *  second section exists inside the "main_runbin2c" function, which runs for
+    *  every input binary file.  The final section is each input binary file's
+    *  resource clean-up which, since it includes system storage, must report
+    *  clean-up failures.
     */
 
-    *prefix = NULL;
-    *suffix = NULL;
-    *global = NULL;
-
     {
-        char const * restrict * restrict parameter;
+        char const * restrict   program;
+        char * const * restrict inpaths;
+        int                     incount;
+        main_arguments          arguments;
+        main_dedup              dedup;
+
+        dedup.pool =     NULL;
+        dedup.poolsize = 0;
+        dedup.origins =  NULL;
+        dedup.tables =   NULL;
+        dedup.counts =   NULL;
+        dedup.sizes =    NULL;
+
+        /*
+        ** The first pass of parsing command-line arguments is simply validating
+        *  syntax.  Success at this stage merely means mandatory parameters are
+        *  present, options are not duplicated, and present options are valid.
+        */
+
+        if ( success )
+        {
+             success = main_parseargs ( argc,
+                                        argv,
+                                        &program,
+                                        &inpaths,
+                                        &incount,
+                                        &arguments );
+        }
+
+        /*
+        ** The "-m" option's parameter is a keyword, which translates into the
+        *  form of the output C file(s).  An unknown keyword is invalid.
+        */
+
+        if ( success && ( arguments.mode != NULL ) )
+        {
+            if ( main_matchkeyword ( arguments.mode,
+                                     "inline" ) )
+            {
+                arguments.form = MAIN_FORM_INLINE;
+            }
+            else if ( main_matchkeyword ( arguments.mode,
+                                          "constexpr" ) )
+            {
+                arguments.form = MAIN_FORM_CONSTEXPR;
+            }
+            else if ( main_matchkeyword ( arguments.mode,
+                                          "module" ) )
+            {
+                arguments.form = MAIN_FORM_MODULE;
+            }
+            else if ( main_matchkeyword ( arguments.mode,
+                                          "columns" ) )
+            {
+                arguments.form = MAIN_FORM_COLUMNS;
+            }
+            else if ( main_matchkeyword ( arguments.mode,
+                                          "text" ) )
+            {
+                arguments.form = MAIN_FORM_TEXT;
+            }
+            else if ( main_matchkeyword ( arguments.mode,
+                                          "lines" ) )
+            {
+                arguments.form = MAIN_FORM_LINES;
+            }
+            else
+            {
+                success = false;
+            }
+        }
+
+        /*
+        ** The few inter-dependent options are simple to validate: the "-g" and
+        *  "-l" options are mutually exclusive and the "-e" option requires one
+        *  of them (i.e.: global scope), because the end pointer is a constant
+        *  that the source file defines.  Forms other than the default one
+        *  decide the scope of the name themselves.
+        */
+
+        if ( success )
+        {
+            success &= ( arguments.global == NULL ) || ( arguments.extent == NULL );
+            success &= ( arguments.end == NULL ) || ( arguments.global != NULL ) || ( arguments.extent != NULL );
+        }
+
+        if ( success && ( arguments.form != MAIN_FORM_DEFAULT ) )
+        {
+            success &= ( arguments.global == NULL ) && ( arguments.extent == NULL );
+        }
+
+        /*
+        ** Alignment is either a keyword or a power of two, whereas the padding
+        *  may be any size.  A section name is only excluded with shards, which
+        *  already have a section of their own.
+        */
+
+        if ( success && ( arguments.alignment != NULL ) )
+        {
+            if ( main_matchkeyword ( arguments.alignment,
+                                     "page" ) )
+            {
+                arguments.alignsize = 4096ul;
+            }
+            else if ( main_matchkeyword ( arguments.alignment,
+                                          "hugepage" ) )
+            {
+                arguments.alignsize = 2097152ul;
+            }
+            else
+            {
+                success &= main_parsesize ( arguments.alignment,
+                                            &arguments.alignsize );
+            }
+
+            success &= arguments.alignsize > 0;
+            success &= ( arguments.alignsize & ( arguments.alignsize - 1u ) ) == 0;
+        }
+
+        if ( success && ( arguments.padding != NULL ) )
+        {
+            success &= main_parsesize ( arguments.padding,
+                                        &arguments.padsize );
+        }
+
+        if ( success && ( arguments.section != NULL ) )
+        {
+            success &= arguments.shards == NULL;
+        }
+
+        /*
+        ** Shards are only meaningful when the array has global scope, given
+        *  that a header file with a static array cannot be split.  The size of
+        *  a shard rounds up to the next multiple of its alignment (i.e.: the
+        *  "-a" option's alignment, if that exceeds "MAIN_SHARDALIGNMENT").
+        */
+
+        if ( success && ( arguments.shards != NULL ) )
+        {
+            unsigned long alignment;
+
+            alignment = MAIN_SHARDALIGNMENT;
+
+            if ( ( arguments.alignment != NULL ) && ( arguments.alignsize > alignment ) )
+            {
+                alignment = arguments.alignsize;
+            }
+
+            success &= ( arguments.global != NULL ) || ( arguments.extent != NULL );
+            success &= main_parsesize ( arguments.shards,
+                                        &arguments.shardsize );
+            success &= arguments.shardsize > 0;
+            success &= arguments.shardsize <= ( ULONG_MAX - alignment );
+
+            if ( success && ( ( arguments.shardsize % alignment ) != 0 ) )
+            {
+                unsigned long requested;
+
+                requested =           arguments.shardsize;
+                arguments.shardsize += alignment - 1u;
+                arguments.shardsize -= arguments.shardsize % alignment;
+
+                ( void ) fprintf ( stderr,
+                                   "-j: shards of %lu bytes, %lu rounded up to a multiple of %lu\n",
+                                   arguments.shardsize,
+                                   requested,
+                                   alignment );
+            }
+        }
+
+        /*
+        ** The "-c" option's parameter is a keyword, like the "-m" option's.  The
+        *  padding of the "-z" option is meaningless for compressed data (the
+        *  decoder would only misread it as another sequence).  The window must
+        *  be a power of two that the LZ4 block format's offsets can reach.
+        */
+
+        if ( success && ( arguments.codec != NULL ) )
+        {
+            if ( main_matchkeyword ( arguments.codec,
+                                     "lz" ) )
+            {
+                arguments.coding = MAIN_CODEC_LZ;
+            }
+            else if ( main_matchkeyword ( arguments.codec,
+                                          "auto" ) )
+            {
+                arguments.coding = MAIN_CODEC_AUTO;
+            }
+            else
+            {
+                success = false;
+            }
+
+            success &= arguments.padding == NULL;
+        }
+
+        if ( success && ( arguments.window != NULL ) )
+        {
+            success &= arguments.codec != NULL;
+            success &= main_parsesize ( arguments.window,
+                                        &arguments.windowsize );
+            success &= arguments.windowsize >= 16u;
+            success &= arguments.windowsize <= MAIN_LZWINDOW;
+            success &= ( arguments.windowsize & ( arguments.windowsize - 1u ) ) == 0;
+        }
+
+        /*
+        ** Compressed blocks require the "-c" option, whereas checksums do
+        *  not.
+        */
+
+        if ( success && ( arguments.blocks != NULL ) )
+        {
+            success &= main_parseblocks ( arguments.blocks,
+                                          &arguments.blocksize,
+                                          &arguments.hashsize );
+            success &= ( arguments.blocksize == 0 ) || ( arguments.codec != NULL );
+        }
+
+        /*
+        ** A hole must have at least one zero byte (trailing zero bytes are
+        *  trimmed regardless of their number).
+        */
+
+        if ( success && ( arguments.holes != NULL ) )
+        {
+            success &= main_parsesize ( arguments.holes,
+                                        &arguments.holesize );
+            success &= arguments.holesize > 0;
+        }
+
+        /*
+        ** Wrapping lines and marking offsets both need a non-zero interval, and
+        *  the offset comments only exist between lines of a wrapped initializer.
+        */
+
+        if ( success && ( arguments.lines != NULL ) )
+        {
+            success &= main_parsesize ( arguments.lines,
+                                        &arguments.linesize );
+            success &= arguments.linesize > 0;
+        }
+
+        if ( success && ( arguments.marks != NULL ) )
+        {
+            success &= arguments.lines != NULL;
+            success &= main_parsesize ( arguments.marks,
+                                        &arguments.marksize );
+            success &= arguments.marksize > 0;
+        }
 
-        parameter = NULL;
+        /*
+        ** A shared dictionary needs a codec that can refer back into it, and
+        *  it must fit in the window with room to spare for the data.
+        */
 
-        if ( argc > 0 )
+        if ( success && ( arguments.dictionary != NULL ) )
         {
+            success &= arguments.codec != NULL;
+        }
 
-            *program =  *argv;
-            parameter = ( char const * restrict * restrict ) inpath;
-
-            argc -= 1;
-            argv += 1u;
+        /*
+        ** The decompression cache of the "-q" option holds decoded data, so it
+        *  requires a codec.  Its functions are part of the header file, which
+        *  the "-g", "-l" and "-j" options replace with a source file.
+        */
 
+        if ( success && ( arguments.cache != NULL ) )
+        {
+            success &= arguments.codec != NULL;
+            success &= ( arguments.global == NULL ) && ( arguments.extent == NULL ) && ( arguments.shards == NULL );
         }
 
-        while ( argc > 0 )
-        {
+        /*
+        ** Training the shared dictionary reads all input binary files before
+        *  any output C file exists, so it doubles as validation that they are
+        *  all readable.
+        */
 
-            if ( **argv == '-' )
-            {
-                char const * restrict option;
+        if ( success && ( arguments.dictionary != NULL ) )
+        {
+            unsigned long capacity;
 
-                success &= parameter == NULL;
+            capacity = arguments.windowsize / 2u;
 
-                option = *argv + 1u;
+            if ( capacity > MAIN_LZDICTIONARY )
+            {
+                capacity = MAIN_LZDICTIONARY;
+            }
 
-                switch ( *option )
-                {
+            arguments.trained = main_traindictionary ( inpaths,
+                                                       incount,
+                                                       capacity,
+                                                       &arguments.dictsize );
+            success =           arguments.trained != NULL;
+        }
 
-                    case 'p':
-                    case 'P':
-                    parameter = prefix;
-                    break;
+        /*
+        ** Deduplication replaces arrays with aliases and chunk tables, which
+        *  compressed data cannot refer into, so it excludes the "-c" option
+        *  (and thereby the options that require it), and the blocks of the
+        *  "-k" option, whose checksums the aliases would not have.
+        */
 
-                    case 's':
-                    case 'S':
-                    parameter = suffix;
-                    break;
+        if ( success && ( arguments.pool != NULL ) )
+        {
+            success &= arguments.codec == NULL;
+            success &= arguments.blocks == NULL;
+        }
 
-                    case 'g':
-                    case 'G':
-                    parameter = global;
-                    break;
+        /*
+        ** Like training, deduplication reads all input binary files before any
+        *  output C file exists.
+        */
 
-                    default:
-                    success = false;
-                    break;
+        if ( success && ( arguments.pool != NULL ) )
+        {
+            success = main_dedupinputs ( inpaths,
+                                         incount,
+                                         &dedup );
+        }
 
-                }
+        /*
+        ** A base makes every array a delta against it, which is a codec of its
+        *  own, so it excludes the "-c" and "-k" options (and thereby the options
+        *  that require them) and the "-z" option, like compression does, and the "-y"
+        *  option, whose aliases and chunk tables would replace the deltas.  The
+        *  base's own array would collide with an input binary file's if the
+        *  base were one of them.
+        */
 
-                option +=  1u;
-                success &= *option == '\0';
+        if ( success && ( arguments.base != NULL ) )
+        {
+            int input;
 
-            }
+            success &= arguments.codec == NULL;
+            success &= arguments.blocks == NULL;
+            success &= arguments.padding == NULL;
+            success &= arguments.pool == NULL;
 
-            else
+            for ( input = 0; input < incount; input += 1 )
             {
-                if ( parameter != NULL )
-                {
-                    *parameter = *argv;
-                    success &=   *parameter != NULL;
-                    parameter =  NULL;
-                }
-                else
-                {
-                    success = false;
-                }
+                success &= strcmp ( inpaths[input],
+                                    arguments.base ) != 0;
             }
 
-            argc -= 1;
-            argv += 1u;
+            arguments.coding = MAIN_CODEC_DELTA;
+        }
 
+        if ( success && ( arguments.base != NULL ) )
+        {
+            arguments.baseline = main_readbase ( arguments.base,
+                                                 &arguments.basesize );
+            success =            arguments.baseline != NULL;
+            arguments.basename = success ? main_shortenname ( ( char * ) arguments.base ) : NULL;
         }
 
-        success &= parameter == NULL;
+        /*
+        ** A pack holds the input binary files' data as is, so it excludes the
+        *  options that replace the data with something else.  The lookup
+        *  function of the "-i" option is part of the pack's index.
+        */
 
-    }
+        if ( success && ( arguments.pack != NULL ) )
+        {
+            success &= arguments.codec == NULL;
+            success &= arguments.blocks == NULL;
+            success &= arguments.pool == NULL;
+            success &= arguments.base == NULL;
+        }
 
-    /*
-    ** The "argc" parameter must be non-negative.  At this point in the
-    *  function, if "argc" were non-negative, then it would be zero now.
-    *  Additionally, the "argv" parameter is null-terminated.  Therefore, this
-    *  final check catches both forms of invalid parameters.
-    */
+        if ( success && ( arguments.lookup != NULL ) )
+        {
+            success &= arguments.pack != NULL;
+        }
 
-    if ( argc < 0 )
-    {
-        success = false;
-    }
-    else
-    {
-        success &= *argv == NULL;
-    }
+        /*
+        ** The pack file of the "-f" option holds no arrays, so only the names'
+        *  prefix and suffix apply to it.  (The other options that only refine
+        *  these already require one of them.)
+        */
 
-    return ( success );
-}
+        if ( success && ( arguments.sidecar != NULL ) )
+        {
+            success &= ( arguments.mode == NULL ) && ( arguments.global == NULL ) && ( arguments.extent == NULL );
+            success &= ( arguments.end == NULL ) && ( arguments.shards == NULL ) && ( arguments.lines == NULL );
+            success &= ( arguments.alignment == NULL ) && ( arguments.section == NULL ) && ( arguments.padding == NULL );
+            success &= ( arguments.codec == NULL ) && ( arguments.holes == NULL ) && ( arguments.pool == NULL );
+            success &= ( arguments.base == NULL ) && ( arguments.pack == NULL ) && ( arguments.blocks == NULL );
+        }
 
+        /*
+        ** The "-r" option's header files choose between the input binary
+        *  file's current data and the array, which must therefore hold the
+        *  data as is, in the default form and with static scope.
+        */
 
+        if ( success && ( arguments.reload != NULL ) )
+        {
+            success &= ( arguments.mode == NULL ) && ( arguments.global == NULL ) && ( arguments.extent == NULL );
+            success &= ( arguments.codec == NULL ) && ( arguments.holes == NULL ) && ( arguments.pool == NULL );
+            success &= ( arguments.base == NULL ) && ( arguments.pack == NULL ) && ( arguments.sidecar == NULL );
+            success &= arguments.blocks == NULL;
+        }
 
-/*
-** main function
-*
-*  This is the program's main function.  It's core purpose is to process
-*  arguments and call the "main_runbin2c" function with validated parameters.
-*
-*  Parameter(s)
-*
-*  argc:  number of elements in "argv", excluding the terminating null element;
-*         must be non-negative
-*  argv:  pointer to an array of pointers to arguments
-*
-*  Return value(s):
-*
-*  EXIT_SUCCESS:  success; the output file exists and is in a valid state
-*  EXIT_FAILURE:  failure; an error occurred and usage information was outputed
-*                 to the standard error pipe (and the output file may or may not
-*                 exist; if it exists, then it may or may not be valid)
-*
-*  Remarks
-*
-*  While this function is the entry point to the program, it largely just
-*  processes arguments and calls the "main_runbin2c" function, which essentially
-*  is the program.  Where to draw the line between processing arguments and
-*  "being the program" is an art.  This function goes all the way to
-*  constructing pathnames and creating a "FILE" object for the input file
-*  because successfully creating a "FILE" object is strong validation of the
-*  pathname.  Conversely, it stops processing symbol names to simply forward
-*  the prefix, the core name, and the suffix as individual parameters to
-*  "main_runbin2c" given that avoids unnecessary heap allocations and keeps the
-*  "main_runbin2c" function's parameters similar to the command-line arguments.
-*/
+        /*
+        ** The access trace of the "-o" option orders the input binary files
+        *  within a pack, so it requires one.  Reading it also validates it.
+        */
 
-int main
-(
-    int                     argc,
-    char * const * restrict argv
-)
-{
-    bool            success;
-    FILE * restrict infile;
-    char * restrict outpath;
+        if ( success && ( arguments.trace != NULL ) )
+        {
+            success &= ( arguments.pack != NULL ) || ( arguments.sidecar != NULL );
+        }
 
-    success = true;
-    infile =  NULL;
-    outpath = NULL;
+        if ( success && ( arguments.trace != NULL ) )
+        {
+            arguments.order = main_readtrace ( arguments.trace,
+                                               inpaths,
+                                               incount,
+                                               &arguments.hotcount );
+            success =         arguments.order != NULL;
+        }
 
-    /*
-    ** This function manages failures in three sections.  This first section
-    *  effectively considers all failures as argument validation failures.  The
-    *  second section exists inside the "main_runbin2c" function.  The final
-    *  section is resource clean-up which, since it includes system storage,
-    *  must report clean-up failures.
-    */
+        /*
+        ** The "constexpr" form's words hold the input binary file's data as is,
+        *  and the whole array in one initializer, so it excludes the options
+        *  that replace the data, skip parts of it or add to it.  So does the
+        *  "module" form, given that a module exports no macros (such as the
+        *  decoded size or the checksum) and C++ has no designated array
+        *  elements.
+        */
 
-    {
-        char const * restrict program;
-        char *       restrict inpath;
-        char const * restrict prefix;
-        char const * restrict suffix;
-        char const * restrict global;
+        if ( success && ( ( arguments.form == MAIN_FORM_CONSTEXPR ) || ( arguments.form == MAIN_FORM_MODULE ) ) )
+        {
+            success &= arguments.codec == NULL;
+            success &= arguments.blocks == NULL;
+            success &= arguments.pool == NULL;
+            success &= arguments.base == NULL;
+            success &= arguments.pack == NULL;
+            success &= arguments.holes == NULL;
+        }
 
         /*
-        ** The first pass of parsing command-line arguments is simply validating
-        *  syntax.  Success at this stage merely means mandatory parameters are
-        *  present, options are not duplicated, and present options are valid.
+        ** The "text" and "lines" forms' string literal holds the input text
+        *  file's data as is, so they exclude the same options as "constexpr",
+        *  as well as the ones that add to the data or to its lines.
         */
 
-        if ( success )
+        if ( success && ( ( arguments.form == MAIN_FORM_TEXT ) || ( arguments.form == MAIN_FORM_LINES ) ) )
         {
-             success = main_parseargs ( argc,
-                                        argv,
-                                        &program,
-                                        &inpath,
-                                        &prefix,
-                                        &suffix,
-                                        &global );
+            success &= ( arguments.codec == NULL ) && ( arguments.blocks == NULL ) && ( arguments.pool == NULL );
+            success &= ( arguments.base == NULL ) && ( arguments.pack == NULL ) && ( arguments.holes == NULL );
+            success &= ( arguments.shards == NULL ) && ( arguments.padding == NULL ) && ( arguments.marks == NULL );
         }
 
         /*
-        ** Given this program does not use environment variables and does not
-        *  have inter-dependent options (e.g.: if one option is present, then
-        *  another option must also be present), creating "FILE" objects for the
-        *  mandatory input file is as much validation as is possible.  (The
-        *  compiler, ultimately, will be the real validator of the combination
-        *  of the prefix, file name, and suffix parameters.)
+        ** The "-t" option's parameter is a type, optionally followed by a byte
+        *  order, or else a layout of records (or its schema file).  A typed
+        *  array holds the input binary file's whole elements, with static
+        *  scope in a header file of its own, so it excludes the options that
+        *  replace the data, skip parts of it, add to it or change the array's
+        *  scope or form.  Only records can be transposed into columns.
         */
 
-        if ( success )
+        if ( success && ( arguments.type != NULL ) && !main_parsetype ( arguments.type,
+                                                                        &arguments.element,
+                                                                        &arguments.bigendian ) )
         {
-            infile =  fopen ( inpath,
-                              "rb" );
-            success = infile != NULL;
+            success = main_readlayout ( arguments.type,
+                                        &arguments.layout,
+                                        &arguments.fields,
+                                        &arguments.fieldcount,
+                                        &arguments.recordsize );
         }
 
-        if ( success )
+        if ( success && ( arguments.form == MAIN_FORM_COLUMNS ) )
+        {
+            success &= arguments.fields != NULL;
+        }
+
+        if ( success && ( arguments.type != NULL ) )
         {
-            outpath =  main_constructoutpath ( inpath );
-            success &= outpath != NULL;
+            success &= ( arguments.form == MAIN_FORM_DEFAULT ) || ( arguments.form == MAIN_FORM_COLUMNS );
+            success &= ( arguments.global == NULL ) && ( arguments.extent == NULL );
+            success &= ( arguments.shards == NULL ) && ( arguments.padding == NULL ) && ( arguments.holes == NULL );
+            success &= ( arguments.codec == NULL ) && ( arguments.blocks == NULL ) && ( arguments.pool == NULL );
+            success &= ( arguments.base == NULL ) && ( arguments.pack == NULL ) && ( arguments.sidecar == NULL );
+            success &= arguments.reload == NULL;
         }
 
         /*
-        ** At this point, argument validation is complete.  Failures until now
-        *  are likely due to invalid arguments.  Therefore, outputing the usage
-        *  information is a suitable reaction to a failure.  This also means
-        *  that "main_runbin2c" must output its own failure information to the
-        *  standard error pipe.
+        ** At this point, argument validation is complete, except for the input
+        *  binary files themselves, which every iteration below validates in
+        *  turn.  Failures until then are likely due to invalid arguments.
+        *  Therefore, outputing the usage information is a suitable reaction to
+        *  a failure.  This also means that "main_runbin2c" must output its own
+        *  failure information to the standard error pipe.
         */
 
         if ( !success )
@@ -1534,50 +17123,259 @@ int main
 
         else
         {
-            success = main_runbin2c ( infile,
-                                      main_shortenname ( inpath ),
-                                      prefix,
-                                      suffix,
-                                      global,
-                                      outpath );
-        }
+            int input;
 
-    }
+            /*
+            ** The shared dictionary's, the decompression cache's and the shared
+            *  pool's output C file(s) reside next to the first input binary
+            *  file's, given that they all share them.
+            */
 
-    /*
-    ** Final clean-up actions typically always succeed.  However, closing a file
-    *  can depend on a flush of at least file metadata to stable media and media
-    *  can fail flushes.  Failed flushes of metadata for the input file can
-    *  render the input file inaccessible (although most file systems try to
-    *  prevent that outcome from a failed flush).
-    */
+            if ( arguments.dictionary != NULL )
+            {
+                success = main_runshared ( inpaths[0],
+                                           arguments.dictionary,
+                                           arguments.trained,
+                                           arguments.dictsize,
+                                           &arguments );
+            }
 
-    {
-        bool clean;
+            if ( success && ( arguments.cache != NULL ) )
+            {
+                success = main_runcache ( inpaths[0],
+                                          &arguments );
+            }
+
+            if ( success && ( dedup.poolsize > 0 ) )
+            {
+                success = main_runshared ( inpaths[0],
+                                           arguments.pool,
+                                           dedup.pool,
+                                           dedup.poolsize,
+                                           &arguments );
+            }
+
+            /*
+            ** The base's output C file(s) reside next to the base itself.
+            */
+
+            if ( success && ( arguments.base != NULL ) )
+            {
+                success = main_runshared ( arguments.base,
+                                           arguments.basename,
+                                           arguments.baseline,
+                                           arguments.basesize,
+                                           &arguments );
+            }
+
+            /*
+            ** With the "-u" option, the pack replaces the input binary files'
+            *  own arrays.
+            */
+
+            if ( success && ( arguments.pack != NULL ) )
+            {
+                success = main_runpack ( inpaths,
+                                         incount,
+                                         &arguments );
+            }
 
-        clean = true;
+            /*
+            ** So does the pack file of the "-f" option.
+            */
 
-        if ( outpath != NULL )
+            if ( success && ( arguments.sidecar != NULL ) )
+            {
+                success = main_runsidecar ( inpaths,
+                                            incount,
+                                            &arguments );
+            }
+
+            for ( input = 0; success && ( arguments.pack == NULL ) && ( arguments.sidecar == NULL ) && ( input < incount ); input += 1 )
+            {
+                FILE * restrict infile;
+                char * restrict outpath;
+                char * restrict origin;
+                bool            unique;
+
+                infile =  NULL;
+                outpath = NULL;
+                origin =  NULL;
+
+                /*
+                ** With the "-y" option, an input binary file that duplicates an
+                *  earlier one or shares chunks with others has no array of its
+                *  own, so only the others' data is read again.
+                */
+
+                unique = ( dedup.origins == NULL ) || ( ( dedup.origins[input] == input ) && ( dedup.tables[input] == NULL ) );
+
+                /*
+                ** An input binary file of the static form that duplicates an
+                *  array is output in full, because the earlier header file has
+                *  no guard against including it twice.
+                */
+
+                unique |= ( dedup.origins != NULL ) && ( dedup.tables[dedup.origins[input]] == NULL ) && ( arguments.form == MAIN_FORM_DEFAULT ) && ( arguments.global == NULL ) && ( arguments.extent == NULL );
+
+                /*
+                ** Given this program does not use environment variables,
+                *  creating "FILE" objects for the input file is as much
+                *  validation as is possible beyond that.  (The compiler,
+                *  ultimately, will be the real validator of the combination of
+                *  the prefix, file name, and suffix parameters.)
+                */
+
+                if ( unique )
+                {
+                    infile =  fopen ( inpaths[input],
+                                      "rb" );
+                    success = infile != NULL;
+                }
+
+                if ( success )
+                {
+                    outpath =  main_constructoutpath ( inpaths[input] );
+                    success &= outpath != NULL;
+                }
+
+                /*
+                ** With the "-r" option, the header file refers to the input
+                *  binary file by its full pathname, so that the program finds
+                *  it regardless of its working directory.
+                */
+
+                if ( success && ( arguments.reload != NULL ) )
+                {
+                    origin =           main_constructfullpath ( inpaths[input] );
+                    success &=         origin != NULL;
+                    arguments.origin = origin;
+                }
+
+                if ( !success )
+                {
+                    main_outputusage ( ( program != NULL ) ? main_findname ( program ) : "bin2c" );
+                }
+                else if ( unique && ( arguments.form == MAIN_FORM_CONSTEXPR ) )
+                {
+                    success = main_runconstexpr ( infile,
+                                                  main_shortenname ( inpaths[input] ),
+                                                  &arguments,
+                                                  outpath );
+                }
+                else if ( unique && ( arguments.type != NULL ) )
+                {
+                    success = main_runtyped ( infile,
+                                              main_shortenname ( inpaths[input] ),
+                                              &arguments,
+                                              outpath );
+                }
+                else if ( unique && ( ( arguments.form == MAIN_FORM_TEXT ) || ( arguments.form == MAIN_FORM_LINES ) ) )
+                {
+                    success = main_runtext ( infile,
+                                             main_shortenname ( inpaths[input] ),
+                                             &arguments,
+                                             outpath );
+                }
+                else if ( unique )
+                {
+                    success = main_runbin2c ( infile,
+                                              main_shortenname ( inpaths[input] ),
+                                              &arguments,
+                                              outpath );
+                }
+                else if ( dedup.origins[input] != input )
+                {
+                    success = main_runalias ( main_shortenname ( inpaths[input] ),
+                                              main_shortenname ( inpaths[dedup.origins[input]] ),
+                                              &arguments,
+                                              dedup.tables[dedup.origins[input]] != NULL,
+                                              outpath );
+                }
+                else
+                {
+                    success = main_runchunks ( main_shortenname ( inpaths[input] ),
+                                               &arguments,
+                                               dedup.tables[input],
+                                               dedup.counts[input],
+                                               dedup.sizes[input],
+                                               outpath );
+                }
+
+                /*
+                ** Final clean-up actions typically always succeed.  However,
+                *  closing a file can depend on a flush of at least file
+                *  metadata to stable media and media can fail flushes.  Failed
+                *  flushes of metadata for the input file can render the input
+                *  file inaccessible (although most file systems try to prevent
+                *  that outcome from a failed flush).
+                */
+
+                {
+                    bool clean;
+
+                    clean = true;
+
+                    if ( origin != NULL )
+                    {
+                        free ( origin );
+                    }
+
+                    if ( outpath != NULL )
+                    {
+                        free ( outpath );
+                    }
+
+                    if ( infile != NULL )
+                    {
+                        int error;
+
+                        error =  fclose ( infile );
+                        clean &= error == 0;
+
+                    }
+
+                    if ( !clean )
+                    {
+                        fputs ( "ERROR: failed to properly close the input file.",
+                                stderr );
+                    }
+
+                    success &= clean;
+
+                }
+
+            }
+
+        }
+
+        if ( arguments.trained != NULL )
         {
-            free ( outpath );
+            free ( arguments.trained );
         }
 
-        if ( infile != NULL )
+        if ( arguments.baseline != NULL )
         {
-            int error;
+            free ( arguments.baseline );
+        }
 
-            error =  fclose ( infile );
-            clean &= error == 0;
+        if ( arguments.order != NULL )
+        {
+            free ( arguments.order );
+        }
 
+        if ( arguments.fields != NULL )
+        {
+            free ( arguments.fields );
         }
 
-        if ( !clean )
+        if ( arguments.layout != NULL )
         {
-            fputs ( "ERROR: failed to properly close the input file.",
-                    stderr );
+            free ( arguments.layout );
         }
 
-        success &= clean;
+        main_releasededup ( &dedup,
+                            incount );
 
     }
 